@@ -22,6 +22,14 @@ bool VehicleProfile::isHighwayBlocked(const std::string& highwayType) const {
     return factor <= 0.0;
 }
 
+std::vector<char> VehicleProfile::getBlockedRoadClasses(const std::vector<std::string>& roadClasses) const {
+    std::vector<char> blocked(roadClasses.size(), 0);
+    for (size_t i = 0; i < roadClasses.size(); i++) {
+        blocked[i] = !roadClasses[i].empty() && isHighwayBlocked(roadClasses[i]);
+    }
+    return blocked;
+}
+
 bool VehicleProfile::isRoadSuitable(const std::unordered_map<std::string, std::string>& tags) const {
     auto it = tags.find("highway");
     if (it == tags.end()) return true; // no info = allowed
@@ -31,6 +31,9 @@ public:
     bool isRoadSuitable(const std::unordered_map<std::string, std::string>& tags) const;
     bool isHighwayBlocked(const std::string& highwayType) const;
 
+    // Blocked flag per road class name (CsrGraph::getRoadClasses()), "" is never blocked
+    std::vector<char> getBlockedRoadClasses(const std::vector<std::string>& roadClasses) const;
+
     // Get preferred tags and avoided tags
     std::vector<std::string> getPreferredTags() const;
     std::vector<std::string> getAvoidedTags() const;
@@ -1,19 +1,22 @@
 #include "./AlgorithmFactory.h"
 #include "../pathfinding/DijkstraAlgorithm.h"
 #include "../pathfinding/AStarAlgorithm.h"
-// #include "../pathfinding/ALTAlgorithm.h"
+#include "../pathfinding/BidirectionalDijkstraAlgorithm.h"
+#include "../pathfinding/ALTAlgorithm.h"
+#include "../pathfinding/ContractionHierarchyAlgorithm.h"
 
 std::unique_ptr<IPathfindingAlgorithm> AlgorithmFactory::createAlgorithm(const std::string& algorithmName) {
     if (algorithmName == "dijkstra") {
         return std::make_unique<DijkstraAlgorithm>();
     } else if (algorithmName == "astar" || algorithmName == "a*" || algorithmName == "a_star") {
         return std::make_unique<AStarAlgorithm>();
-    }
-    // TODO: Implement ALT algorithm
-    // else if (algorithmName == "alt") {
-    //     return std::make_unique<ALTAlgorithm>();
-    // } 
-    else {
+    } else if (algorithmName == "bidijkstra" || algorithmName == "bidirectional_dijkstra" || algorithmName == "bidirectional") {
+        return std::make_unique<BidirectionalDijkstraAlgorithm>();
+    } else if (algorithmName == "alt") {
+        return std::make_unique<ALTAlgorithm>();
+    } else if (algorithmName == "ch" || algorithmName == "contraction_hierarchies") {
+        return std::make_unique<ContractionHierarchyAlgorithm>();
+    } else {
         throw std::invalid_argument("Unknown algorithm: " + algorithmName);
     }
 }
\ No newline at end of file
@@ -2,8 +2,10 @@
 #include "../tsp/IGAlgorithm.h"
 #include "../tsp/IGNAlgorithm.h"
 #include "../tsp/ILSBAlgorithm.h"
-// TODO: Implement these TSP algorithms
-// #include "../tsp/IGSAAlgorithm.h"
+#include "../tsp/ILSDBAlgorithm.h"
+#include "../tsp/LKAlgorithm.h"
+#include "../tsp/IGSAAlgorithm.h"
+#include "../tsp/HeldKarpAlgorithm.h"
 #include <stdexcept>
 
 std::unique_ptr<ITspAlgorithm> TspAlgorithmFactory::create(const std::string& algorithmName) {
@@ -13,10 +15,30 @@ std::unique_ptr<ITspAlgorithm> TspAlgorithmFactory::create(const std::string& al
         return std::make_unique<IGNAlgorithm>();
     } else if (algorithmName == "ilsb" || algorithmName == "ILSB" || algorithmName == "ils_b" || algorithmName == "ILS_B") {
         return std::make_unique<ILSBAlgorithm>();
+    } else if (algorithmName == "ilsdb" || algorithmName == "ILSDB" || algorithmName == "ils_db" || algorithmName == "ILS_DB") {
+        return std::make_unique<ILSDBAlgorithm>();
+    } else if (algorithmName == "lk" || algorithmName == "LK") {
+        return std::make_unique<LKAlgorithm>();
     } else if (algorithmName == "igsa" || algorithmName == "IGSA") {
-        // IGSA requires threading - not implemented yet
-        throw std::invalid_argument("IGSA algorithm requires threading implementation (not available yet)");
+        return std::make_unique<IGSAAlgorithm>();
+    } else if (algorithmName == "heldkarp" || algorithmName == "held_karp" || algorithmName == "hk" || algorithmName == "HK") {
+        return std::make_unique<HeldKarpAlgorithm>();
     } else {
         throw std::invalid_argument("Unknown TSP algorithm: " + algorithmName);
     }
 }
+
+
+TourConstruction TspAlgorithmFactory::parseConstruction(const std::string& constructionName) {
+    if (constructionName == "nn" || constructionName == "NN" || constructionName == "nearest") {
+        return TourConstruction::NEAREST_NEIGHBOR;
+    } else if (constructionName == "greedy" || constructionName == "greedy_edge" || constructionName == "GREEDY_EDGE") {
+        return TourConstruction::GREEDY_EDGE;
+    } else if (constructionName == "christofides" || constructionName == "CHRISTOFIDES" || constructionName == "mst") {
+        return TourConstruction::CHRISTOFIDES;
+    } else if (constructionName == "hilbert" || constructionName == "sfc" || constructionName == "SFC") {
+        return TourConstruction::SPACE_FILLING_CURVE;
+    } else {
+        throw std::invalid_argument("Unknown tour construction: " + constructionName);
+    }
+}
@@ -11,9 +11,26 @@ public:
      * 
      * Supported algorithms:
      * - "ig" → IGAlgorithm
-     * - "igsa" → IGSAAlgorithm
-     * - "ilsa" → ILSAAlgorithm
-     * - ...
+     * - "ign" → IGNAlgorithm (iterated greedy, no local search)
+     * - "ilsb" / "ils_b" → ILSBAlgorithm (shuffle + local search)
+     * - "ilsdb" / "ils_db" → ILSDBAlgorithm (double-bridge + Or-opt)
+     * - "lk" → LKAlgorithm (chained Lin-Kernighan)
+     * - "igsa" → IGSAAlgorithm (multi-threaded, simulated annealing)
+     * - "heldkarp" / "held_karp" / "hk" → HeldKarpAlgorithm (exact, small instances)
+     * 
+     * @throws std::invalid_argument for an unknown name
      */
     static std::unique_ptr<ITspAlgorithm> create(const std::string& algorithmName);
+    
+    /**
+     * @brief Starting-tour heuristic by name (see ITspAlgorithm::setConstruction)
+     * 
+     * - "nn" / "nearest" → NEAREST_NEIGHBOR
+     * - "greedy" / "greedy_edge" → GREEDY_EDGE
+     * - "christofides" / "mst" → CHRISTOFIDES
+     * - "hilbert" / "sfc" → SPACE_FILLING_CURVE
+     * 
+     * @throws std::invalid_argument for an unknown name
+     */
+    static TourConstruction parseConstruction(const std::string& constructionName);
 };
@@ -0,0 +1,157 @@
+#include "ALTAlgorithm.h"
+#include "../../utils/exceptions/GraphException.h"
+#include <limits>
+#include <algorithm>
+#include <chrono>
+
+ALTAlgorithm::ALTAlgorithm(std::shared_ptr<LandmarkStore> landmarkStore, QueueKind queueKind)
+    : nodesExplored(0),
+      executionTime(0.0),
+      queueKind(queueKind),
+      landmarkStore(landmarkStore ? std::move(landmarkStore) : std::make_shared<LandmarkStore>()) {}
+
+std::vector<int64_t> ALTAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId
+) {
+    return findPath(graph, startNodeId, endNodeId, nullptr);
+}
+
+std::vector<int64_t> ALTAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId,
+    const VehicleProfile* vehicleProfile
+) {
+    SearchWorkspace workspace;
+    return findPath(graph, startNodeId, endNodeId, vehicleProfile, workspace);
+}
+
+std::vector<int64_t> ALTAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId,
+    const VehicleProfile* vehicleProfile,
+    SearchWorkspace& workspace
+) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    nodesExplored = 0;
+    executionTime = 0.0;
+
+    // Verification of nodes existence
+    if (!graph.hasNode(startNodeId)) {
+        throw GraphException("Start node not found in graph");
+    }
+    if (!graph.hasNode(endNodeId)) {
+        throw GraphException("End node not found in graph");
+    }
+
+    std::vector<int64_t> path;
+
+    auto csr = graph.getCsrGraph();
+    if (!csr) {
+        return path; // Adjacency not built = no route
+    }
+
+    uint32_t startIdx = csr->getNodeIndex(startNodeId);
+    uint32_t endIdx = csr->getNodeIndex(endNodeId);
+    if (startIdx == CsrGraph::INVALID_INDEX || endIdx == CsrGraph::INVALID_INDEX) {
+        return path; // Node added after the snapshot = not connected
+    }
+
+    std::vector<char> blockedClasses;
+    if (vehicleProfile != nullptr) {
+        blockedClasses = vehicleProfile->getBlockedRoadClasses(csr->getRoadClasses());
+    }
+
+    // Landmarks of the same restrictions (loaded from disk or built once)
+    auto landmarks = landmarkStore->getOrBuild(csr, blockedClasses);
+
+    workspace.reset(csr->getNodeCount());
+
+    // Landmark potentials are consistent, but rounding can still make f dip
+    // by an ulp: keep the radix heap out, as in A*
+    bool pathFound = (queueKind == QueueKind::BinaryHeap)
+        ? search<LazyBinaryHeap>(*csr, *landmarks, startIdx, endIdx, blockedClasses, workspace)
+        : search<IndexedDaryHeap<4>>(*csr, *landmarks, startIdx, endIdx, blockedClasses, workspace);
+
+    if (pathFound) {
+        uint32_t current = endIdx;
+        while (current != startIdx) {
+            uint32_t arc = workspace.getParentArc(current);
+            path.push_back(csr->getArcEdgeId(arc));
+            current = csr->getArcSource(arc);
+        }
+        std::reverse(path.begin(), path.end());
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    executionTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    return path;
+}
+
+template <class Queue>
+bool ALTAlgorithm::search(
+    const CsrGraph& csr,
+    const LandmarkTable& landmarks,
+    uint32_t startIdx,
+    uint32_t endIdx,
+    const std::vector<char>& blockedClasses,
+    SearchWorkspace& workspace
+) {
+    const double INF = std::numeric_limits<double>::infinity();
+    std::vector<uint32_t> active = landmarks.selectActive(startIdx, endIdx, ACTIVE_LANDMARKS);
+
+    // Bound says the goal is unreachable under these restrictions
+    double initialH = landmarks.lowerBound(startIdx, endIdx, active);
+    if (initialH == INF) {
+        return false;
+    }
+
+    Queue& openSet = workspace.getQueue<Queue>();
+    openSet.reset(csr.getNodeCount());
+
+    workspace.update(startIdx, 0.0, SearchWorkspace::NO_ARC);
+    openSet.push(startIdx, initialH);
+
+    while (!openSet.empty()) {
+        QueueEntry current = openSet.pop();
+        uint32_t currentIdx = current.node;
+
+        if (workspace.isSettled(currentIdx)) continue;
+        workspace.markSettled(currentIdx);
+        nodesExplored++;
+
+        // Goal reached
+        if (currentIdx == endIdx) {
+            return true;
+        }
+
+        double currentG = workspace.getDistance(currentIdx);
+        uint32_t arcEnd = csr.arcEnd(currentIdx);
+
+        for (uint32_t arc = csr.arcBegin(currentIdx); arc < arcEnd; arc++) {
+            uint32_t neighborIdx = csr.getArcTarget(arc);
+
+            if (workspace.isSettled(neighborIdx)) continue;
+
+            if (!blockedClasses.empty() && blockedClasses[csr.getArcRoadClass(arc)]) {
+                continue;
+            }
+
+            double tentativeG = currentG + csr.getArcWeight(arc);
+
+            if (tentativeG < workspace.getDistance(neighborIdx)) {
+                double h = landmarks.lowerBound(neighborIdx, endIdx, active);
+                if (h == INF) continue;     // Cannot reach the goal from here
+
+                workspace.update(neighborIdx, tentativeG, arc);
+                openSet.push(neighborIdx, tentativeG + h);
+            }
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../../core/interfaces/IPathfindingAlgorithm.h"
+#include "../../core/entities/Graph.h"
+#include "../VehicleProfile.h"
+#include "SearchWorkspace.h"
+#include "LandmarkTable.h"
+
+/**
+ * @brief ALT: A* with landmark lower bounds (triangle inequality)
+ *
+ * Same search as A*, but h(n) comes from a LandmarkTable built for the
+ * query's vehicle restrictions. The bound is exact-admissible and
+ * consistent, so the first path that settles the goal is optimal.
+ * Only the landmarks with the best bound at the start are consulted.
+ *
+ * Reference: Goldberg & Harrelson, "Computing the Shortest Path: A* Search
+ * Meets Graph Theory" (SODA 2005)
+ */
+class ALTAlgorithm : public IPathfindingAlgorithm {
+private:
+    size_t nodesExplored = 0;
+    double executionTime = 0.0;
+    QueueKind queueKind;
+    std::shared_ptr<LandmarkStore> landmarkStore;
+
+    // Landmarks consulted per query (chosen by bound at the start node)
+    static constexpr size_t ACTIVE_LANDMARKS = 6;
+
+    /**
+     * @brief Main loop, instantiated once per priority queue type
+     * @return true if the goal was settled
+     */
+    template <class Queue>
+    bool search(
+        const CsrGraph& csr,
+        const LandmarkTable& landmarks,
+        uint32_t startIdx,
+        uint32_t endIdx,
+        const std::vector<char>& blockedClasses,
+        SearchWorkspace& workspace
+    );
+
+public:
+    // Without a shared store the landmarks are built on the first query
+    explicit ALTAlgorithm(
+        std::shared_ptr<LandmarkStore> landmarkStore = nullptr,
+        QueueKind queueKind = DEFAULT_QUEUE_KIND
+    );
+
+    void setLandmarkStore(std::shared_ptr<LandmarkStore> store) { landmarkStore = std::move(store); }
+    const std::shared_ptr<LandmarkStore>& getLandmarkStore() const { return landmarkStore; }
+
+    std::vector<int64_t> findPath(
+        const Graph& graph,
+        int64_t startNodeId,
+        int64_t endNodeId
+    ) override;
+
+    std::vector<int64_t> findPath(
+        const Graph& graph,
+        int64_t startNodeId,
+        int64_t endNodeId,
+        const VehicleProfile* vehicleProfile
+    ) override;
+
+    std::vector<int64_t> findPath(
+        const Graph& graph,
+        int64_t startNodeId,
+        int64_t endNodeId,
+        const VehicleProfile* vehicleProfile,
+        SearchWorkspace& workspace
+    ) override;
+
+    std::string getName() const override { return "alt"; }
+    size_t getNodesExplored() const override { return nodesExplored; }
+    double getExecutionTime() const override { return executionTime; }
+};
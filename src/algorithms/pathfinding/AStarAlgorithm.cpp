@@ -1,25 +1,14 @@
 #include "AStarAlgorithm.h"
-#include <queue>
-#include <unordered_map>
-#include <unordered_set>
+#include <limits>
 #include <cmath>
 #include <algorithm>
 #include <iostream>
 #include <chrono>
 
-double AStarAlgorithm::calculateHeuristic(const Graph& graph, int64_t fromId, int64_t toId) const {
-    const Node* fromNode = graph.getNode(fromId);
-    const Node* toNode = graph.getNode(toId);
-    
-    if (!fromNode || !toNode) {
-        return 0.0;
-    }
-    
+double AStarAlgorithm::calculateHeuristic(const CsrGraph& csr, uint32_t fromIdx, uint32_t toIdx) const {
     // Manhattan distance approximation (fast)
-    double manhattan = std::abs(const_cast<Node*>(fromNode)->getCoordinate().getLatitude() - 
-                                const_cast<Node*>(toNode)->getCoordinate().getLatitude()) +
-                      std::abs(const_cast<Node*>(fromNode)->getCoordinate().getLongitude() - 
-                                const_cast<Node*>(toNode)->getCoordinate().getLongitude());
+    double manhattan = std::abs(csr.getLatitude(fromIdx) - csr.getLatitude(toIdx)) +
+                      std::abs(csr.getLongitude(fromIdx) - csr.getLongitude(toIdx));
     
     // Convert to meters (approximate)
     double meters = manhattan * 111000.0;
@@ -28,124 +17,142 @@ double AStarAlgorithm::calculateHeuristic(const Graph& graph, int64_t fromId, in
     return meters * HEURISTIC_SCALE;
 }
 
-bool AStarAlgorithm::isEdgeRestrictedForVehicle(const Edge& edge, const VehicleProfile* vehicleProfile) const {
-    if (!vehicleProfile || edge.getTags().find("highway") == edge.getTags().end()) {
-        return false;
-    }
-    
-    std::string highway = edge.getTags().at("highway");
-    return vehicleProfile->isHighwayBlocked(highway);
-}
-
-std::vector<int64_t> AStarAlgorithm::findPath(
-    const Graph& graph,
-    int64_t startNodeId,
-    int64_t endNodeId
+template <class Queue>
+bool AStarAlgorithm::search(
+    const CsrGraph& csr,
+    uint32_t startIdx,
+    uint32_t endIdx,
+    const std::vector<char>& blockedClasses,
+    SearchWorkspace& workspace,
+    int& expansions
 ) {
-    return findPath(graph, startNodeId, endNodeId, nullptr);
-}
-
-std::vector<int64_t> AStarAlgorithm::findPath(
-    const Graph& graph,
-    int64_t startNodeId,
-    int64_t endNodeId,
-    const VehicleProfile* vehicleProfile
-) {
-    auto startTime = std::chrono::high_resolution_clock::now();
-    nodesExplored = 0;
-    
-    // Initialize data structures
-    std::unordered_map<int64_t, double> gScore;  // g(n) - actual cost from start
-    std::unordered_map<int64_t, double> fScore;  // f(n) - g(n) + h(n)
-    std::unordered_map<int64_t, int64_t> cameFrom;
-    std::unordered_map<int64_t, int64_t> cameFromEdge;  // Store edge IDs for path reconstruction
-    std::unordered_set<int64_t> visited;
-    
-    std::priority_queue<QueueNode, std::vector<QueueNode>, std::greater<QueueNode>> openSet;
+    Queue& openSet = workspace.getQueue<Queue>();
+    openSet.reset(csr.getNodeCount());
     
     // Initialize start node
-    gScore[startNodeId] = 0.0;
-    double initialH = calculateHeuristic(graph, startNodeId, endNodeId);
-    fScore[startNodeId] = initialH;
-    openSet.push({startNodeId, initialH});
-    
-    int expansions = 0;
-    bool pathFound = false;
+    workspace.update(startIdx, 0.0, SearchWorkspace::NO_ARC);
+    double initialH = calculateHeuristic(csr, startIdx, endIdx);
+    openSet.push(startIdx, initialH);
     
     while (!openSet.empty() && expansions < MAX_EXPANSIONS) {
-        QueueNode current = openSet.top();
-        openSet.pop();
+        QueueEntry current = openSet.pop();
         
-        int64_t currentId = current.nodeId;
+        uint32_t currentIdx = current.node;
         
-        if (visited.count(currentId)) continue;
-        visited.insert(currentId);
+        if (workspace.isSettled(currentIdx)) continue;
+        workspace.markSettled(currentIdx);
         nodesExplored++;
         expansions++;
         
         // Goal reached
-        if (currentId == endNodeId) {
-            pathFound = true;
-            break;
+        if (currentIdx == endIdx) {
+            return true;
         }
         
-        // Explore neighbors
-        const std::vector<Edge*> neighbors = graph.getOutgoingEdges(currentId);
+        // Explore neighbors (contiguous arc range)
+        double currentG = workspace.getDistance(currentIdx);
+        uint32_t arcEnd = csr.arcEnd(currentIdx);
         
-        for (const auto& edge : neighbors) {
-            int64_t neighborId = edge->getTarget()->getId();
+        for (uint32_t arc = csr.arcBegin(currentIdx); arc < arcEnd; arc++) {
+            uint32_t neighborIdx = csr.getArcTarget(arc);
             
-            if (visited.count(neighborId)) continue;
+            if (workspace.isSettled(neighborIdx)) continue;
             
             // Check vehicle restrictions
-            if (vehicleProfile && isEdgeRestrictedForVehicle(*edge, vehicleProfile)) {
+            if (!blockedClasses.empty() && blockedClasses[csr.getArcRoadClass(arc)]) {
                 continue;
             }
             
-            double weight = edge->getDistance().getMeters();
-            double tentativeG = gScore[currentId] + weight;
+            double tentativeG = currentG + csr.getArcWeight(arc);
             
             // Check if this path is better
-            if (gScore.find(neighborId) == gScore.end() || tentativeG < gScore[neighborId]) {
-                cameFrom[neighborId] = currentId;
-                cameFromEdge[neighborId] = edge->getId();  // Store edge ID
-                gScore[neighborId] = tentativeG;
-                
-                double h = calculateHeuristic(graph, neighborId, endNodeId);
-                double f = tentativeG + h;
-                fScore[neighborId] = f;
+            if (tentativeG < workspace.getDistance(neighborIdx)) {
+                workspace.update(neighborIdx, tentativeG, arc);
                 
-                openSet.push({neighborId, f});
+                double h = calculateHeuristic(csr, neighborIdx, endIdx);
+                openSet.push(neighborIdx, tentativeG + h);   // Insert or decrease-key
             }
         }
     }
     
-    // Reconstruct path (as edge IDs, not node IDs)
+    return false;
+}
+
+std::vector<int64_t> AStarAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId
+) {
+    return findPath(graph, startNodeId, endNodeId, nullptr);
+}
+
+std::vector<int64_t> AStarAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId,
+    const VehicleProfile* vehicleProfile
+) {
+    SearchWorkspace workspace;
+    return findPath(graph, startNodeId, endNodeId, vehicleProfile, workspace);
+}
+
+std::vector<int64_t> AStarAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId,
+    const VehicleProfile* vehicleProfile,
+    SearchWorkspace& workspace
+) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    nodesExplored = 0;
+    
     std::vector<int64_t> path;
     
+    // Routing runs on the frozen CSR snapshot (no hashing or copies per relaxation)
+    auto csr = graph.getCsrGraph();
+    uint32_t startIdx = csr ? csr->getNodeIndex(startNodeId) : CsrGraph::INVALID_INDEX;
+    uint32_t endIdx = csr ? csr->getNodeIndex(endNodeId) : CsrGraph::INVALID_INDEX;
+    
+    if (startIdx == CsrGraph::INVALID_INDEX || endIdx == CsrGraph::INVALID_INDEX) {
+        std::cout << "[A*][WARN] Start or end node not in routing graph" << std::endl;
+        auto endTime = std::chrono::high_resolution_clock::now();
+        executionTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+        return path;
+    }
+    
+    // Vehicle restrictions resolved once per query (one flag per road class)
+    std::vector<char> blockedClasses;
+    if (vehicleProfile) {
+        blockedClasses = vehicleProfile->getBlockedRoadClasses(csr->getRoadClasses());
+    }
+    
+    // Initialize data structures (O(1) reset of the reusable workspace)
+    // workspace distance = g(n), actual cost from start
+    workspace.reset(csr->getNodeCount());
+    
+    // A* keys (f = g + h) are not monotone, so the radix heap is not an option here
+    int expansions = 0;
+    bool pathFound = (queueKind == QueueKind::BinaryHeap)
+        ? search<LazyBinaryHeap>(*csr, startIdx, endIdx, blockedClasses, workspace, expansions)
+        : search<IndexedDaryHeap<4>>(*csr, startIdx, endIdx, blockedClasses, workspace, expansions);
+    
+    // Reconstruct path (as edge IDs, not node IDs)
     if (!pathFound) {
         std::cout << "[A*][WARN] No path found. Expansions: " << expansions << std::endl;
     } else {
-        int64_t current = endNodeId;
-        while (current != startNodeId) {
-            auto it = cameFromEdge.find(current);
-            if (it == cameFromEdge.end()) {
+        uint32_t current = endIdx;
+        while (current != startIdx) {
+            uint32_t arc = workspace.getParentArc(current);
+            if (arc == SearchWorkspace::NO_ARC) {
                 std::cout << "[A*][ERROR] Path reconstruction failed" << std::endl;
                 path.clear();
                 break;
             }
             
-            int64_t edgeId = it->second;
-            path.push_back(edgeId);
+            path.push_back(csr->getArcEdgeId(arc));
             
             // Move to previous node
-            auto nodeIt = cameFrom.find(current);
-            if (nodeIt == cameFrom.end()) {
-                std::cout << "[A*][ERROR] cameFrom missing" << std::endl;
-                path.clear();
-                break;
-            }
-            current = nodeIt->second;
+            current = csr->getArcSource(arc);
         }
         std::reverse(path.begin(), path.end());
         
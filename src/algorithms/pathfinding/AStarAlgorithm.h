@@ -3,6 +3,7 @@
 #include "../../core/interfaces/IPathfindingAlgorithm.h"
 #include "../../core/entities/Graph.h"
 #include "../VehicleProfile.h"
+#include "SearchWorkspace.h"
 #include <cmath>
 
 /**
@@ -22,6 +23,7 @@ class AStarAlgorithm : public IPathfindingAlgorithm {
 private:
     size_t nodesExplored = 0;
     double executionTime = 0.0;
+    QueueKind queueKind;
     
     // Heuristic scale factor to maintain admissibility
     static constexpr double HEURISTIC_SCALE = 0.95;
@@ -29,28 +31,30 @@ private:
     // Max expansions to prevent infinite loops
     static constexpr int MAX_EXPANSIONS = 200000;
     
-    struct QueueNode {
-        int64_t nodeId;
-        double fScore;  // f(n) = g(n) + h(n)
-        
-        bool operator>(const QueueNode& other) const {
-            return fScore > other.fScore;
-        }
-    };
-    
     /**
      * @brief Calculate Euclidean heuristic between two nodes
      * Uses Manhattan distance approximation for speed
      */
-    double calculateHeuristic(const Graph& graph, int64_t fromId, int64_t toId) const;
+    double calculateHeuristic(const CsrGraph& csr, uint32_t fromIdx, uint32_t toIdx) const;
     
     /**
-     * @brief Check if edge is blocked for vehicle profile
+     * @brief Main loop, instantiated once per priority queue type
+     * @return true if the goal was settled
      */
-    bool isEdgeRestrictedForVehicle(const Edge& edge, const VehicleProfile* vehicleProfile) const;
+    template <class Queue>
+    bool search(
+        const CsrGraph& csr,
+        uint32_t startIdx,
+        uint32_t endIdx,
+        const std::vector<char>& blockedClasses,
+        SearchWorkspace& workspace,
+        int& expansions
+    );
     
 public:
-    AStarAlgorithm() : nodesExplored(0), executionTime(0.0) {}
+    // RadixHeap needs monotone keys; A* falls back to the 4-ary heap for it
+    explicit AStarAlgorithm(QueueKind queueKind = DEFAULT_QUEUE_KIND)
+        : nodesExplored(0), executionTime(0.0), queueKind(queueKind) {}
     
     std::vector<int64_t> findPath(
         const Graph& graph, 
@@ -64,6 +68,14 @@ public:
         int64_t endNodeId,
         const VehicleProfile* vehicleProfile
     ) override;
+
+    std::vector<int64_t> findPath(
+        const Graph& graph, 
+        int64_t startNodeId, 
+        int64_t endNodeId,
+        const VehicleProfile* vehicleProfile,
+        SearchWorkspace& workspace
+    ) override;
     
     std::string getName() const override { return "a_star"; }
     size_t getNodesExplored() const override { return nodesExplored; }
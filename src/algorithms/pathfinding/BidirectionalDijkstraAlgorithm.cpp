@@ -0,0 +1,199 @@
+#include "BidirectionalDijkstraAlgorithm.h"
+#include "../../utils/exceptions/GraphException.h"
+#include <limits>
+#include <algorithm>
+
+std::vector<int64_t> BidirectionalDijkstraAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId
+) {
+    return findPath(graph, startNodeId, endNodeId, nullptr);
+}
+
+std::vector<int64_t> BidirectionalDijkstraAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId,
+    const VehicleProfile* vehicleProfile
+) {
+    SearchWorkspace workspace;
+    return findPath(graph, startNodeId, endNodeId, vehicleProfile, workspace);
+}
+
+std::vector<int64_t> BidirectionalDijkstraAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId,
+    const VehicleProfile* vehicleProfile,
+    SearchWorkspace& workspace
+) {
+    nodesExplored = 0;
+    executionTime = 0.0;
+
+    // Verification of nodes existence
+    if (!graph.hasNode(startNodeId)) {
+        throw GraphException("Start node not found in graph");
+    }
+    if (!graph.hasNode(endNodeId)) {
+        throw GraphException("End node not found in graph");
+    }
+
+    std::vector<int64_t> path;
+
+    auto csr = graph.getCsrGraph();
+    if (!csr) {
+        return path; // Adjacency not built = no route
+    }
+
+    uint32_t startIdx = csr->getNodeIndex(startNodeId);
+    uint32_t endIdx = csr->getNodeIndex(endNodeId);
+    if (startIdx == CsrGraph::INVALID_INDEX || endIdx == CsrGraph::INVALID_INDEX) {
+        return path; // Node added after the snapshot = not connected
+    }
+    if (startIdx == endIdx) {
+        return path;
+    }
+
+    std::vector<char> blockedClasses;
+    if (vehicleProfile != nullptr) {
+        blockedClasses = vehicleProfile->getBlockedRoadClasses(csr->getRoadClasses());
+    }
+
+    SearchWorkspace& backward = workspace.getBackward();
+    workspace.reset(csr->getNodeCount());
+    backward.reset(csr->getNodeCount());
+
+    uint32_t meetingIdx;
+    switch (queueKind) {
+        case QueueKind::BinaryHeap:
+            meetingIdx = search<LazyBinaryHeap>(*csr, startIdx, endIdx, blockedClasses, workspace, backward);
+            break;
+        case QueueKind::RadixHeap:
+            meetingIdx = search<RadixHeap>(*csr, startIdx, endIdx, blockedClasses, workspace, backward);
+            break;
+        default:
+            meetingIdx = search<IndexedDaryHeap<4>>(*csr, startIdx, endIdx, blockedClasses, workspace, backward);
+            break;
+    }
+
+    if (meetingIdx == CsrGraph::INVALID_INDEX) {
+        return path; // Empty path = no route found
+    }
+
+    // Forward half: meeting node back to start, then reversed
+    uint32_t currentNode = meetingIdx;
+    while (currentNode != startIdx) {
+        uint32_t arc = workspace.getParentArc(currentNode);
+        path.push_back(csr->getArcEdgeId(arc));
+        currentNode = csr->getArcSource(arc);
+    }
+    std::reverse(path.begin(), path.end());
+
+    // Backward half: parent arcs already point towards the end node
+    currentNode = meetingIdx;
+    while (currentNode != endIdx) {
+        uint32_t arc = backward.getParentArc(currentNode);
+        path.push_back(csr->getArcEdgeId(arc));
+        currentNode = csr->getArcTarget(arc);
+    }
+
+    return path;
+}
+
+template <class Queue>
+uint32_t BidirectionalDijkstraAlgorithm::search(
+    const CsrGraph& csr,
+    uint32_t startIdx,
+    uint32_t endIdx,
+    const std::vector<char>& blockedClasses,
+    SearchWorkspace& forward,
+    SearchWorkspace& backward
+) {
+    Queue& forwardQueue = forward.getQueue<Queue>();
+    Queue& backwardQueue = backward.getQueue<Queue>();
+    forwardQueue.reset(csr.getNodeCount());
+    backwardQueue.reset(csr.getNodeCount());
+
+    forward.update(startIdx, 0.0, SearchWorkspace::NO_ARC);
+    forwardQueue.push(startIdx, 0.0);
+    backward.update(endIdx, 0.0, SearchWorkspace::NO_ARC);
+    backwardQueue.push(endIdx, 0.0);
+
+    double best = std::numeric_limits<double>::infinity();
+    uint32_t meetingIdx = CsrGraph::INVALID_INDEX;
+
+    while (!forwardQueue.empty() && !backwardQueue.empty()) {
+        double topForward = forwardQueue.top().key;
+        double topBackward = backwardQueue.top().key;
+
+        // No undiscovered path can beat the best meeting point any more
+        if (topForward + topBackward >= best) {
+            break;
+        }
+
+        if (topForward <= topBackward) {
+            QueueEntry current = forwardQueue.pop();
+            if (forward.isSettled(current.node)) {
+                continue; // Stale entry (lazy heaps only)
+            }
+            forward.markSettled(current.node);
+            nodesExplored++;
+
+            double currentDist = forward.getDistance(current.node);
+            uint32_t arcEnd = csr.arcEnd(current.node);
+
+            for (uint32_t arc = csr.arcBegin(current.node); arc < arcEnd; arc++) {
+                if (!blockedClasses.empty() && blockedClasses[csr.getArcRoadClass(arc)]) {
+                    continue; // Skip restricted edges
+                }
+
+                uint32_t neighborIdx = csr.getArcTarget(arc);
+                double newDist = currentDist + csr.getArcWeight(arc);
+
+                if (newDist < forward.getDistance(neighborIdx)) {
+                    forward.update(neighborIdx, newDist, arc);
+                    forwardQueue.push(neighborIdx, newDist);
+                }
+                double total = newDist + backward.getDistance(neighborIdx);
+                if (total < best) {
+                    best = total;
+                    meetingIdx = neighborIdx;
+                }
+            }
+        } else {
+            QueueEntry current = backwardQueue.pop();
+            if (backward.isSettled(current.node)) {
+                continue;
+            }
+            backward.markSettled(current.node);
+            nodesExplored++;
+
+            // Incoming arcs: relax from the arc target to its source
+            double currentDist = backward.getDistance(current.node);
+            uint32_t inEnd = csr.inArcEnd(current.node);
+
+            for (uint32_t i = csr.inArcBegin(current.node); i < inEnd; i++) {
+                uint32_t arc = csr.getInArc(i);
+                if (!blockedClasses.empty() && blockedClasses[csr.getArcRoadClass(arc)]) {
+                    continue;
+                }
+
+                uint32_t neighborIdx = csr.getArcSource(arc);
+                double newDist = currentDist + csr.getArcWeight(arc);
+
+                if (newDist < backward.getDistance(neighborIdx)) {
+                    backward.update(neighborIdx, newDist, arc);
+                    backwardQueue.push(neighborIdx, newDist);
+                }
+                double total = newDist + forward.getDistance(neighborIdx);
+                if (total < best) {
+                    best = total;
+                    meetingIdx = neighborIdx;
+                }
+            }
+        }
+    }
+
+    return meetingIdx;
+}
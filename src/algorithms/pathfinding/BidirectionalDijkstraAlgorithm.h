@@ -0,0 +1,66 @@
+#pragma once
+
+#include "../../core/interfaces/IPathfindingAlgorithm.h"
+#include "../../core/entities/Graph.h"
+#include "../VehicleProfile.h"
+#include "SearchWorkspace.h"
+
+/**
+ * @brief Dijkstra run simultaneously from the start (outgoing arcs) and
+ * from the end (incoming arcs, CsrGraph reverse index)
+ *
+ * Each step expands the side whose queue minimum is smaller. Every relaxed
+ * arc that touches the other search updates the best meeting distance; the
+ * search stops once topForward + topBackward >= best, which is exact for
+ * non-negative weights. Explores roughly two balls of half the radius.
+ */
+class BidirectionalDijkstraAlgorithm : public IPathfindingAlgorithm {
+private:
+    size_t nodesExplored = 0;
+    double executionTime = 0.0;
+    QueueKind queueKind;
+
+    /**
+     * @brief Main loop; returns the meeting node (INVALID_INDEX if none)
+     */
+    template <class Queue>
+    uint32_t search(
+        const CsrGraph& csr,
+        uint32_t startIdx,
+        uint32_t endIdx,
+        const std::vector<char>& blockedClasses,
+        SearchWorkspace& forward,
+        SearchWorkspace& backward
+    );
+
+public:
+    explicit BidirectionalDijkstraAlgorithm(QueueKind queueKind = DEFAULT_QUEUE_KIND)
+        : nodesExplored(0), executionTime(0.0), queueKind(queueKind) {}
+
+    std::vector<int64_t> findPath(
+        const Graph& graph,
+        int64_t startNodeId,
+        int64_t endNodeId
+    ) override;
+
+    std::vector<int64_t> findPath(
+        const Graph& graph,
+        int64_t startNodeId,
+        int64_t endNodeId,
+        const VehicleProfile* vehicleProfile
+    ) override;
+
+    std::vector<int64_t> findPath(
+        const Graph& graph,
+        int64_t startNodeId,
+        int64_t endNodeId,
+        const VehicleProfile* vehicleProfile,
+        SearchWorkspace& workspace
+    ) override;
+
+    QueueKind getQueueKind() const { return queueKind; }
+
+    std::string getName() const override { return "bidirectional_dijkstra"; }
+    size_t getNodesExplored() const override { return nodesExplored; }
+    double getExecutionTime() const override { return executionTime; }
+};
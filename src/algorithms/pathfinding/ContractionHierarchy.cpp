@@ -0,0 +1,404 @@
+#include "ContractionHierarchy.h"
+#include "PriorityQueues.h"
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <functional>
+
+namespace {
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+// Witness searches give up after this many settled nodes (a missed witness
+// only costs an unnecessary shortcut, never a wrong distance)
+constexpr size_t SIMULATE_SETTLE_LIMIT = 25;
+constexpr size_t CONTRACT_SETTLE_LIMIT = 500;
+
+/**
+ * @brief Dynamic graph used while contracting (adjacency lists of pool edges)
+ */
+class Contractor {
+private:
+    const size_t n_;
+
+    // Edge pool (becomes the ContractionHierarchy pool)
+    std::vector<uint32_t> from_, to_, arc_, first_, second_;
+    std::vector<double> weight_;
+    std::vector<char> active_;
+
+    // Live edges per node (edges to contracted nodes are removed)
+    std::vector<std::vector<uint32_t>> out_;
+    std::vector<std::vector<uint32_t>> in_;
+    std::vector<char> contracted_;
+    std::vector<uint32_t> deletedNeighbors_;
+
+    // Witness search state (dist_ is INF except for touched_ entries)
+    std::vector<double> dist_;
+    std::vector<uint32_t> touched_;
+    std::vector<uint32_t> targetStamp_;     // == searchStamp_: node is a pending target
+    uint32_t searchStamp_ = 0;
+    IndexedDaryHeap<4> heap_;
+
+    uint32_t addEdge(uint32_t from, uint32_t to, double weight, uint32_t arc, uint32_t first, uint32_t second) {
+        // Keep a single live edge per (from, to): the shortest
+        for (uint32_t& existing : out_[from]) {
+            if (to_[existing] != to) continue;
+            if (weight_[existing] <= weight) return existing;
+
+            uint32_t id = pushEdge(from, to, weight, arc, first, second);
+            active_[existing] = 0;
+            std::replace(in_[to].begin(), in_[to].end(), existing, id);
+            existing = id;
+            return id;
+        }
+
+        uint32_t id = pushEdge(from, to, weight, arc, first, second);
+        out_[from].push_back(id);
+        in_[to].push_back(id);
+        return id;
+    }
+
+    uint32_t pushEdge(uint32_t from, uint32_t to, double weight, uint32_t arc, uint32_t first, uint32_t second) {
+        uint32_t id = static_cast<uint32_t>(from_.size());
+        from_.push_back(from);
+        to_.push_back(to);
+        weight_.push_back(weight);
+        arc_.push_back(arc);
+        first_.push_back(first);
+        second_.push_back(second);
+        active_.push_back(1);
+        return id;
+    }
+
+    /**
+     * @brief Bounded Dijkstra from source avoiding excluded; stops early once
+     * every out-neighbor of excluded is settled
+     */
+    void witnessSearch(uint32_t source, uint32_t excluded, double maxDist, size_t settleLimit) {
+        for (uint32_t node : touched_) dist_[node] = INF;
+        touched_.clear();
+        heap_.reset(n_);
+
+        searchStamp_++;
+        size_t pendingTargets = 0;
+        for (uint32_t edge : out_[excluded]) {
+            uint32_t w = to_[edge];
+            if (w != source && targetStamp_[w] != searchStamp_) {
+                targetStamp_[w] = searchStamp_;
+                pendingTargets++;
+            }
+        }
+
+        dist_[source] = 0.0;
+        touched_.push_back(source);
+        heap_.push(source, 0.0);
+
+        size_t settled = 0;
+        while (!heap_.empty()) {
+            QueueEntry current = heap_.pop();
+            if (current.key > maxDist || ++settled > settleLimit) break;
+            if (targetStamp_[current.node] == searchStamp_ && --pendingTargets == 0) break;
+
+            for (uint32_t edge : out_[current.node]) {
+                uint32_t w = to_[edge];
+                if (contracted_[w] || w == excluded) continue;
+
+                double newDist = current.key + weight_[edge];
+                if (newDist < dist_[w]) {
+                    if (dist_[w] == INF) touched_.push_back(w);
+                    dist_[w] = newDist;
+                    heap_.push(w, newDist);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Shortcuts needed to contract v (added to the graph if apply)
+     */
+    int contract(uint32_t v, bool apply) {
+        int shortcuts = 0;
+        const size_t limit = apply ? CONTRACT_SETTLE_LIMIT : SIMULATE_SETTLE_LIMIT;
+
+        // Shortcuts only touch the lists of u and w, never those of v
+        for (uint32_t inEdge : in_[v]) {
+            uint32_t u = from_[inEdge];
+            if (contracted_[u] || u == v) continue;
+
+            double maxOut = -1.0;
+            for (uint32_t outEdge : out_[v]) {
+                uint32_t w = to_[outEdge];
+                if (contracted_[w] || w == u || w == v) continue;
+                maxOut = std::max(maxOut, weight_[outEdge]);
+            }
+            if (maxOut < 0.0) continue;
+
+            witnessSearch(u, v, weight_[inEdge] + maxOut, limit);
+
+            for (uint32_t outEdge : out_[v]) {
+                uint32_t w = to_[outEdge];
+                if (contracted_[w] || w == u || w == v) continue;
+
+                double viaV = weight_[inEdge] + weight_[outEdge];
+                if (dist_[w] <= viaV) continue;    // Witness path found
+
+                shortcuts++;
+                if (apply) {
+                    addEdge(u, w, viaV, ContractionHierarchy::NO_EDGE, inEdge, outEdge);
+                }
+            }
+        }
+        return shortcuts;
+    }
+
+    int liveDegree(uint32_t v) const {
+        int degree = 0;
+        for (uint32_t edge : in_[v]) if (!contracted_[from_[edge]]) degree++;
+        for (uint32_t edge : out_[v]) if (!contracted_[to_[edge]]) degree++;
+        return degree;
+    }
+
+    // Edge difference (shortcuts added minus edges removed) keeps the graph
+    // sparse; contracted neighbors spread contraction evenly over the map
+    double priority(uint32_t v) {
+        int removed = liveDegree(v);
+        int added = contract(v, false);
+        return 2.0 * (added - removed) + deletedNeighbors_[v];
+    }
+
+public:
+    Contractor(const CsrGraph& csr, const std::vector<char>& blockedClasses)
+        : n_(csr.getNodeCount()),
+          out_(n_), in_(n_), contracted_(n_, 0), deletedNeighbors_(n_, 0),
+          dist_(n_, INF), targetStamp_(n_, 0) {
+        for (uint32_t arc = 0; arc < csr.getArcCount(); arc++) {
+            if (!blockedClasses.empty() && blockedClasses[csr.getArcRoadClass(arc)]) continue;
+            uint32_t source = csr.getArcSource(arc);
+            uint32_t target = csr.getArcTarget(arc);
+            if (source == target) continue;
+            addEdge(source, target, csr.getArcWeight(arc), arc,
+                    ContractionHierarchy::NO_EDGE, ContractionHierarchy::NO_EDGE);
+        }
+    }
+
+    std::vector<uint32_t> run() {
+        using Entry = std::pair<double, uint32_t>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> order;
+        std::vector<double> current(n_);
+
+        for (uint32_t v = 0; v < n_; v++) {
+            current[v] = priority(v);
+            order.push({current[v], v});
+        }
+
+        std::vector<uint32_t> rank(n_, 0);
+        std::vector<uint32_t> neighbors;
+        uint32_t nextRank = 0;
+
+        while (!order.empty()) {
+            auto [prio, v] = order.top();
+            order.pop();
+            if (contracted_[v] || prio != current[v]) continue;    // Stale entry
+
+            // Lazy update: contract only if still the minimum
+            double fresh = priority(v);
+            if (!order.empty() && fresh > order.top().first) {
+                current[v] = fresh;
+                order.push({fresh, v});
+                continue;
+            }
+
+            contract(v, true);
+            contracted_[v] = 1;
+            rank[v] = nextRank++;
+
+            // Neighbors lost an edge and gained shortcuts: refresh their priority
+            neighbors.clear();
+            for (uint32_t edge : in_[v]) if (!contracted_[from_[edge]]) neighbors.push_back(from_[edge]);
+            for (uint32_t edge : out_[v]) if (!contracted_[to_[edge]]) neighbors.push_back(to_[edge]);
+            std::sort(neighbors.begin(), neighbors.end());
+            neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+            // Drop v from the remaining graph (its edges stay in the pool)
+            for (uint32_t u : neighbors) {
+                auto& out = out_[u];
+                out.erase(std::remove_if(out.begin(), out.end(),
+                    [&](uint32_t edge) { return to_[edge] == v; }), out.end());
+                auto& in = in_[u];
+                in.erase(std::remove_if(in.begin(), in.end(),
+                    [&](uint32_t edge) { return from_[edge] == v; }), in.end());
+            }
+
+            for (uint32_t u : neighbors) {
+                deletedNeighbors_[u]++;
+                current[u] = priority(u);
+                order.push({current[u], u});
+            }
+        }
+        return rank;
+    }
+
+    std::vector<uint32_t>& from() { return from_; }
+    std::vector<uint32_t>& to() { return to_; }
+    std::vector<double>& weight() { return weight_; }
+    std::vector<uint32_t>& arc() { return arc_; }
+    std::vector<uint32_t>& first() { return first_; }
+    std::vector<uint32_t>& second() { return second_; }
+    std::vector<char>& active() { return active_; }
+};
+
+}
+
+ContractionHierarchy::ContractionHierarchy(
+    std::string restrictionKey,
+    uint64_t fingerprint,
+    std::vector<uint32_t> rank,
+    std::vector<uint32_t> edgeFrom,
+    std::vector<uint32_t> edgeTo,
+    std::vector<double> edgeWeight,
+    std::vector<uint32_t> edgeArc,
+    std::vector<uint32_t> edgeFirst,
+    std::vector<uint32_t> edgeSecond,
+    std::vector<char> edgeActive
+) : restrictionKey_(std::move(restrictionKey)),
+    fingerprint_(fingerprint),
+    rank_(std::move(rank)),
+    edgeFrom_(std::move(edgeFrom)),
+    edgeTo_(std::move(edgeTo)),
+    edgeWeight_(std::move(edgeWeight)),
+    edgeArc_(std::move(edgeArc)),
+    edgeFirst_(std::move(edgeFirst)),
+    edgeSecond_(std::move(edgeSecond)),
+    edgeActive_(std::move(edgeActive)) {
+    buildSearchGraph();
+}
+
+void ContractionHierarchy::buildSearchGraph() {
+    const size_t n = rank_.size();
+    upOffsets_.assign(n + 1, 0);
+    downOffsets_.assign(n + 1, 0);
+
+    // Counting sort: upward edges by source, downward edges by target
+    for (uint32_t e = 0; e < edgeFrom_.size(); e++) {
+        if (!edgeActive_[e]) continue;
+        if (rank_[edgeFrom_[e]] < rank_[edgeTo_[e]]) {
+            upOffsets_[edgeFrom_[e] + 1]++;
+        } else {
+            downOffsets_[edgeTo_[e] + 1]++;
+        }
+    }
+    for (size_t v = 0; v < n; v++) {
+        upOffsets_[v + 1] += upOffsets_[v];
+        downOffsets_[v + 1] += downOffsets_[v];
+    }
+
+    upEdges_.resize(upOffsets_[n]);
+    downEdges_.resize(downOffsets_[n]);
+    std::vector<uint32_t> upPos(upOffsets_.begin(), upOffsets_.end() - 1);
+    std::vector<uint32_t> downPos(downOffsets_.begin(), downOffsets_.end() - 1);
+
+    for (uint32_t e = 0; e < edgeFrom_.size(); e++) {
+        if (!edgeActive_[e]) continue;
+        if (rank_[edgeFrom_[e]] < rank_[edgeTo_[e]]) {
+            upEdges_[upPos[edgeFrom_[e]]++] = e;
+        } else {
+            downEdges_[downPos[edgeTo_[e]]++] = e;
+        }
+    }
+}
+
+std::shared_ptr<const ContractionHierarchy> ContractionHierarchy::build(
+    const CsrGraph& csr,
+    const std::vector<char>& blockedClasses
+) {
+    Contractor contractor(csr, blockedClasses);
+    std::vector<uint32_t> rank = contractor.run();
+
+    return std::make_shared<const ContractionHierarchy>(
+        csr.getRestrictionKey(blockedClasses),
+        csr.computeFingerprint(),
+        std::move(rank),
+        std::move(contractor.from()),
+        std::move(contractor.to()),
+        std::move(contractor.weight()),
+        std::move(contractor.arc()),
+        std::move(contractor.first()),
+        std::move(contractor.second()),
+        std::move(contractor.active())
+    );
+}
+
+size_t ContractionHierarchy::getShortcutCount() const {
+    return std::count(edgeArc_.begin(), edgeArc_.end(), NO_EDGE);
+}
+
+void ContractionHierarchy::unpackEdge(uint32_t edge, std::vector<uint32_t>& arcs) const {
+    // Explicit stack: second child pushed first so the first one comes out first
+    std::vector<uint32_t> stack = {edge};
+    while (!stack.empty()) {
+        uint32_t current = stack.back();
+        stack.pop_back();
+
+        if (edgeArc_[current] != NO_EDGE) {
+            arcs.push_back(edgeArc_[current]);
+        } else {
+            stack.push_back(edgeSecond_[current]);
+            stack.push_back(edgeFirst_[current]);
+        }
+    }
+}
+
+void ContractionHierarchyStore::bindLocked(const std::shared_ptr<const CsrGraph>& csr) {
+    if (graph_.lock() != csr) {
+        hierarchies_.clear();
+        graph_ = csr;
+    }
+}
+
+std::shared_ptr<const ContractionHierarchy> ContractionHierarchyStore::getOrBuild(
+    const std::shared_ptr<const CsrGraph>& csr,
+    const std::vector<char>& blockedClasses
+) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bindLocked(csr);
+
+    std::string key = csr->getRestrictionKey(blockedClasses);
+    auto it = hierarchies_.find(key);
+    if (it != hierarchies_.end()) {
+        return it->second;
+    }
+
+    auto hierarchy = ContractionHierarchy::build(*csr, blockedClasses);
+    hierarchies_[key] = hierarchy;
+    return hierarchy;
+}
+
+bool ContractionHierarchyStore::add(
+    const std::shared_ptr<const CsrGraph>& csr,
+    std::shared_ptr<const ContractionHierarchy> hierarchy
+) {
+    if (!hierarchy || hierarchy->getNodeCount() != csr->getNodeCount() ||
+        hierarchy->getFingerprint() != csr->computeFingerprint()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    bindLocked(csr);
+    hierarchies_[hierarchy->getRestrictionKey()] = std::move(hierarchy);
+    return true;
+}
+
+std::vector<std::shared_ptr<const ContractionHierarchy>> ContractionHierarchyStore::getHierarchies() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::shared_ptr<const ContractionHierarchy>> hierarchies;
+    for (const auto& [key, hierarchy] : hierarchies_) {
+        hierarchies.push_back(hierarchy);
+    }
+    return hierarchies;
+}
+
+void ContractionHierarchyStore::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    hierarchies_.clear();
+    graph_.reset();
+}
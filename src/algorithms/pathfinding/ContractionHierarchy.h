@@ -0,0 +1,145 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <map>
+#include <cstdint>
+#include "../../core/entities/CsrGraph.h"
+
+/**
+ * @brief Contraction Hierarchy over a CsrGraph (one per set of blocked road classes)
+ *
+ * Preprocessing contracts nodes in order of importance (edge difference +
+ * contracted neighbors, lazy updates). Contracting v adds a shortcut u -> w
+ * for each pair of neighbors unless a local witness search finds a path
+ * u -> w avoiding v that is no longer. rank[v] = contraction order.
+ *
+ * Every edge (original arc or shortcut) lives in one pool and is indexed
+ * twice for queries:
+ * - up(v):   edges v -> w with rank[w] > rank[v] (forward search)
+ * - down(v): edges w -> v with rank[w] > rank[v] (backward search)
+ * A shortcut stores its two child edges, so a query path of pool edges
+ * unpacks recursively back to CsrGraph arcs.
+ *
+ * Reference: Geisberger, Sanders, Schultes, Delling, "Contraction
+ * Hierarchies: Faster and Simpler Hierarchical Routing in Road Networks"
+ * (WEA 2008)
+ */
+class ContractionHierarchy {
+public:
+    static constexpr uint32_t NO_EDGE = 0xFFFFFFFFu;
+
+private:
+    std::string restrictionKey_;
+    uint64_t fingerprint_ = 0;
+    std::vector<uint32_t> rank_;
+
+    // Edge pool (original arcs and shortcuts)
+    std::vector<uint32_t> edgeFrom_;
+    std::vector<uint32_t> edgeTo_;
+    std::vector<double> edgeWeight_;
+    std::vector<uint32_t> edgeArc_;         // CsrGraph arc, NO_EDGE for shortcuts
+    std::vector<uint32_t> edgeFirst_;       // Shortcut children: from -> middle
+    std::vector<uint32_t> edgeSecond_;      //                    middle -> to
+    std::vector<char> edgeActive_;          // False if replaced by a shorter parallel edge
+
+    // Query adjacency (offsets have N + 1 entries, lists hold pool ids)
+    std::vector<uint32_t> upOffsets_;
+    std::vector<uint32_t> upEdges_;
+    std::vector<uint32_t> downOffsets_;
+    std::vector<uint32_t> downEdges_;
+
+    void buildSearchGraph();
+
+public:
+    ContractionHierarchy(
+        std::string restrictionKey,
+        uint64_t fingerprint,
+        std::vector<uint32_t> rank,
+        std::vector<uint32_t> edgeFrom,
+        std::vector<uint32_t> edgeTo,
+        std::vector<double> edgeWeight,
+        std::vector<uint32_t> edgeArc,
+        std::vector<uint32_t> edgeFirst,
+        std::vector<uint32_t> edgeSecond,
+        std::vector<char> edgeActive
+    );
+
+    /**
+     * @brief Order and contract every node of csr (arcs of blocked classes excluded)
+     */
+    static std::shared_ptr<const ContractionHierarchy> build(
+        const CsrGraph& csr,
+        const std::vector<char>& blockedClasses
+    );
+
+    const std::string& getRestrictionKey() const { return restrictionKey_; }
+    uint64_t getFingerprint() const { return fingerprint_; }
+    size_t getNodeCount() const { return rank_.size(); }
+    size_t getEdgeCount() const { return edgeFrom_.size(); }
+    size_t getShortcutCount() const;
+
+    uint32_t getRank(uint32_t node) const { return rank_[node]; }
+    const std::vector<uint32_t>& getRanks() const { return rank_; }
+
+    // Edge pool
+    uint32_t getEdgeFrom(uint32_t edge) const { return edgeFrom_[edge]; }
+    uint32_t getEdgeTo(uint32_t edge) const { return edgeTo_[edge]; }
+    double getEdgeWeight(uint32_t edge) const { return edgeWeight_[edge]; }
+    uint32_t getEdgeArc(uint32_t edge) const { return edgeArc_[edge]; }
+    uint32_t getEdgeFirst(uint32_t edge) const { return edgeFirst_[edge]; }
+    uint32_t getEdgeSecond(uint32_t edge) const { return edgeSecond_[edge]; }
+    bool isEdgeActive(uint32_t edge) const { return edgeActive_[edge] != 0; }
+    bool isShortcut(uint32_t edge) const { return edgeArc_[edge] == NO_EDGE; }
+
+    // Upward edges out of node: getUpEdge(i) for i in [upBegin, upEnd)
+    uint32_t upBegin(uint32_t node) const { return upOffsets_[node]; }
+    uint32_t upEnd(uint32_t node) const { return upOffsets_[node + 1]; }
+    uint32_t getUpEdge(uint32_t i) const { return upEdges_[i]; }
+
+    // Edges into node from higher-ranked nodes
+    uint32_t downBegin(uint32_t node) const { return downOffsets_[node]; }
+    uint32_t downEnd(uint32_t node) const { return downOffsets_[node + 1]; }
+    uint32_t getDownEdge(uint32_t i) const { return downEdges_[i]; }
+
+    /**
+     * @brief Append the CsrGraph arcs behind a pool edge, in path order
+     */
+    void unpackEdge(uint32_t edge, std::vector<uint32_t>& arcs) const;
+};
+
+/**
+ * @brief Thread-safe set of hierarchies for one graph, one per restriction key
+ *
+ * Same contract as LandmarkStore: built on first use, shared by every query,
+ * dropped when a different CsrGraph snapshot is bound.
+ */
+class ContractionHierarchyStore {
+private:
+    std::mutex mutex_;
+    std::weak_ptr<const CsrGraph> graph_;
+    std::map<std::string, std::shared_ptr<const ContractionHierarchy>> hierarchies_;
+
+    void bindLocked(const std::shared_ptr<const CsrGraph>& csr);
+
+public:
+    /**
+     * @brief Hierarchy for csr under the given restrictions (built if missing)
+     */
+    std::shared_ptr<const ContractionHierarchy> getOrBuild(
+        const std::shared_ptr<const CsrGraph>& csr,
+        const std::vector<char>& blockedClasses
+    );
+
+    /**
+     * @brief Add a hierarchy loaded from disk (ignored if its fingerprint does not match csr)
+     */
+    bool add(const std::shared_ptr<const CsrGraph>& csr, std::shared_ptr<const ContractionHierarchy> hierarchy);
+
+    // Snapshot of the current hierarchies (for persistence)
+    std::vector<std::shared_ptr<const ContractionHierarchy>> getHierarchies();
+
+    void clear();
+};
@@ -0,0 +1,204 @@
+#include "ContractionHierarchyAlgorithm.h"
+#include "../../utils/exceptions/GraphException.h"
+#include <limits>
+#include <algorithm>
+#include <chrono>
+
+ContractionHierarchyAlgorithm::ContractionHierarchyAlgorithm(
+    std::shared_ptr<ContractionHierarchyStore> hierarchyStore,
+    QueueKind queueKind
+) : nodesExplored(0),
+    executionTime(0.0),
+    queueKind(queueKind),
+    hierarchyStore(hierarchyStore ? std::move(hierarchyStore) : std::make_shared<ContractionHierarchyStore>()) {}
+
+std::vector<int64_t> ContractionHierarchyAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId
+) {
+    return findPath(graph, startNodeId, endNodeId, nullptr);
+}
+
+std::vector<int64_t> ContractionHierarchyAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId,
+    const VehicleProfile* vehicleProfile
+) {
+    SearchWorkspace workspace;
+    return findPath(graph, startNodeId, endNodeId, vehicleProfile, workspace);
+}
+
+std::vector<int64_t> ContractionHierarchyAlgorithm::findPath(
+    const Graph& graph,
+    int64_t startNodeId,
+    int64_t endNodeId,
+    const VehicleProfile* vehicleProfile,
+    SearchWorkspace& workspace
+) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    nodesExplored = 0;
+    executionTime = 0.0;
+
+    // Verification of nodes existence
+    if (!graph.hasNode(startNodeId)) {
+        throw GraphException("Start node not found in graph");
+    }
+    if (!graph.hasNode(endNodeId)) {
+        throw GraphException("End node not found in graph");
+    }
+
+    std::vector<int64_t> path;
+
+    auto csr = graph.getCsrGraph();
+    if (!csr) {
+        return path; // Adjacency not built = no route
+    }
+
+    uint32_t startIdx = csr->getNodeIndex(startNodeId);
+    uint32_t endIdx = csr->getNodeIndex(endNodeId);
+    if (startIdx == CsrGraph::INVALID_INDEX || endIdx == CsrGraph::INVALID_INDEX) {
+        return path; // Node added after the snapshot = not connected
+    }
+    if (startIdx == endIdx) {
+        return path;
+    }
+
+    std::vector<char> blockedClasses;
+    if (vehicleProfile != nullptr) {
+        blockedClasses = vehicleProfile->getBlockedRoadClasses(csr->getRoadClasses());
+    }
+
+    // Hierarchy of the same restrictions (loaded from disk or built once)
+    auto ch = hierarchyStore->getOrBuild(csr, blockedClasses);
+
+    SearchWorkspace& backward = workspace.getBackward();
+    workspace.reset(csr->getNodeCount());
+    backward.reset(csr->getNodeCount());
+
+    uint32_t meetingIdx;
+    switch (queueKind) {
+        case QueueKind::BinaryHeap:
+            meetingIdx = search<LazyBinaryHeap>(*ch, startIdx, endIdx, workspace, backward);
+            break;
+        case QueueKind::RadixHeap:
+            meetingIdx = search<RadixHeap>(*ch, startIdx, endIdx, workspace, backward);
+            break;
+        default:
+            meetingIdx = search<IndexedDaryHeap<4>>(*ch, startIdx, endIdx, workspace, backward);
+            break;
+    }
+
+    if (meetingIdx != CsrGraph::INVALID_INDEX) {
+        // Hierarchy edges start -> meeting (collected backwards) then meeting -> end
+        std::vector<uint32_t> chEdges;
+        for (uint32_t node = meetingIdx; node != startIdx; ) {
+            uint32_t edge = workspace.getParentArc(node);
+            chEdges.push_back(edge);
+            node = ch->getEdgeFrom(edge);
+        }
+        std::reverse(chEdges.begin(), chEdges.end());
+        for (uint32_t node = meetingIdx; node != endIdx; ) {
+            uint32_t edge = backward.getParentArc(node);
+            chEdges.push_back(edge);
+            node = ch->getEdgeTo(edge);
+        }
+
+        std::vector<uint32_t> arcs;
+        for (uint32_t edge : chEdges) {
+            ch->unpackEdge(edge, arcs);
+        }
+        path.reserve(arcs.size());
+        for (uint32_t arc : arcs) {
+            path.push_back(csr->getArcEdgeId(arc));
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    executionTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    return path;
+}
+
+template <class Queue>
+uint32_t ContractionHierarchyAlgorithm::search(
+    const ContractionHierarchy& ch,
+    uint32_t startIdx,
+    uint32_t endIdx,
+    SearchWorkspace& forward,
+    SearchWorkspace& backward
+) {
+    Queue& forwardQueue = forward.getQueue<Queue>();
+    Queue& backwardQueue = backward.getQueue<Queue>();
+    forwardQueue.reset(ch.getNodeCount());
+    backwardQueue.reset(ch.getNodeCount());
+
+    forward.update(startIdx, 0.0, SearchWorkspace::NO_ARC);
+    forwardQueue.push(startIdx, 0.0);
+    backward.update(endIdx, 0.0, SearchWorkspace::NO_ARC);
+    backwardQueue.push(endIdx, 0.0);
+
+    double best = std::numeric_limits<double>::infinity();
+    uint32_t meetingIdx = CsrGraph::INVALID_INDEX;
+    bool forwardDone = false;
+    bool backwardDone = false;
+
+    while (!(forwardDone && backwardDone)) {
+        // Upward searches cannot stop at the first meeting: each side runs
+        // until its own minimum is no better than the best path found
+        forwardDone = forwardDone || forwardQueue.empty() || forwardQueue.top().key >= best;
+        backwardDone = backwardDone || backwardQueue.empty() || backwardQueue.top().key >= best;
+
+        bool expandForward;
+        if (forwardDone && backwardDone) break;
+        else if (forwardDone) expandForward = false;
+        else if (backwardDone) expandForward = true;
+        else expandForward = forwardQueue.top().key <= backwardQueue.top().key;
+
+        SearchWorkspace& self = expandForward ? forward : backward;
+        SearchWorkspace& other = expandForward ? backward : forward;
+        QueueEntry current = expandForward ? forwardQueue.pop() : backwardQueue.pop();
+
+        if (self.isSettled(current.node)) {
+            continue; // Stale entry (lazy heaps only)
+        }
+        self.markSettled(current.node);
+        nodesExplored++;
+
+        double currentDist = self.getDistance(current.node);
+        double total = currentDist + other.getDistance(current.node);
+        if (total < best) {
+            best = total;
+            meetingIdx = current.node;
+        }
+
+        // Stall-on-demand: a higher node reaching us more cheaply means our
+        // distance is not final along upward paths, so do not relax from here
+        uint32_t stallBegin = expandForward ? ch.downBegin(current.node) : ch.upBegin(current.node);
+        uint32_t stallEnd = expandForward ? ch.downEnd(current.node) : ch.upEnd(current.node);
+        bool stalled = false;
+        for (uint32_t i = stallBegin; i < stallEnd && !stalled; i++) {
+            uint32_t edge = expandForward ? ch.getDownEdge(i) : ch.getUpEdge(i);
+            uint32_t higher = expandForward ? ch.getEdgeFrom(edge) : ch.getEdgeTo(edge);
+            stalled = self.getDistance(higher) + ch.getEdgeWeight(edge) < currentDist;
+        }
+        if (stalled) continue;
+
+        uint32_t relaxBegin = expandForward ? ch.upBegin(current.node) : ch.downBegin(current.node);
+        uint32_t relaxEnd = expandForward ? ch.upEnd(current.node) : ch.downEnd(current.node);
+        for (uint32_t i = relaxBegin; i < relaxEnd; i++) {
+            uint32_t edge = expandForward ? ch.getUpEdge(i) : ch.getDownEdge(i);
+            uint32_t neighborIdx = expandForward ? ch.getEdgeTo(edge) : ch.getEdgeFrom(edge);
+            double newDist = currentDist + ch.getEdgeWeight(edge);
+
+            if (newDist < self.getDistance(neighborIdx)) {
+                self.update(neighborIdx, newDist, edge);
+                if (expandForward) forwardQueue.push(neighborIdx, newDist);
+                else backwardQueue.push(neighborIdx, newDist);
+            }
+        }
+    }
+
+    return meetingIdx;
+}
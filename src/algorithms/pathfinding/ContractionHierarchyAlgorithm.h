@@ -0,0 +1,72 @@
+#pragma once
+
+#include "../../core/interfaces/IPathfindingAlgorithm.h"
+#include "../../core/entities/Graph.h"
+#include "../VehicleProfile.h"
+#include "SearchWorkspace.h"
+#include "ContractionHierarchy.h"
+
+/**
+ * @brief Point-to-point queries on a Contraction Hierarchy
+ *
+ * Bidirectional Dijkstra that only climbs: the forward search follows
+ * upward edges from the start, the backward search follows downward edges
+ * (reversed) from the end. Each side stops once its queue minimum reaches
+ * the best meeting distance. Stall-on-demand skips relaxing nodes that a
+ * higher-ranked node already reaches more cheaply. The meeting path is then
+ * unpacked from shortcuts back to original edge ids.
+ */
+class ContractionHierarchyAlgorithm : public IPathfindingAlgorithm {
+private:
+    size_t nodesExplored = 0;
+    double executionTime = 0.0;
+    QueueKind queueKind;
+    std::shared_ptr<ContractionHierarchyStore> hierarchyStore;
+
+    /**
+     * @brief Upward search; returns the meeting node (INVALID_INDEX if none)
+     */
+    template <class Queue>
+    uint32_t search(
+        const ContractionHierarchy& ch,
+        uint32_t startIdx,
+        uint32_t endIdx,
+        SearchWorkspace& forward,
+        SearchWorkspace& backward
+    );
+
+public:
+    // Without a shared store the hierarchy is built on the first query
+    explicit ContractionHierarchyAlgorithm(
+        std::shared_ptr<ContractionHierarchyStore> hierarchyStore = nullptr,
+        QueueKind queueKind = DEFAULT_QUEUE_KIND
+    );
+
+    void setHierarchyStore(std::shared_ptr<ContractionHierarchyStore> store) { hierarchyStore = std::move(store); }
+    const std::shared_ptr<ContractionHierarchyStore>& getHierarchyStore() const { return hierarchyStore; }
+
+    std::vector<int64_t> findPath(
+        const Graph& graph,
+        int64_t startNodeId,
+        int64_t endNodeId
+    ) override;
+
+    std::vector<int64_t> findPath(
+        const Graph& graph,
+        int64_t startNodeId,
+        int64_t endNodeId,
+        const VehicleProfile* vehicleProfile
+    ) override;
+
+    std::vector<int64_t> findPath(
+        const Graph& graph,
+        int64_t startNodeId,
+        int64_t endNodeId,
+        const VehicleProfile* vehicleProfile,
+        SearchWorkspace& workspace
+    ) override;
+
+    std::string getName() const override { return "contraction_hierarchies"; }
+    size_t getNodesExplored() const override { return nodesExplored; }
+    double getExecutionTime() const override { return executionTime; }
+};
@@ -1,8 +1,6 @@
 #include "DijkstraAlgorithm.h"
 #include "../../utils/exceptions/GraphException.h"
 #include <memory>
-#include <queue>
-#include <unordered_set>
 #include <limits>
 #include <algorithm>
 
@@ -19,6 +17,17 @@ std::vector<int64_t> DijkstraAlgorithm::findPath(
     int64_t startNodeId, 
     int64_t endNodeId,
     const VehicleProfile* vehicleProfile
+) {
+    SearchWorkspace workspace;
+    return findPath(graph, startNodeId, endNodeId, vehicleProfile, workspace);
+}
+
+std::vector<int64_t> DijkstraAlgorithm::findPath(
+    const Graph& graph, 
+    int64_t startNodeId, 
+    int64_t endNodeId,
+    const VehicleProfile* vehicleProfile,
+    SearchWorkspace& workspace
 ) {
     nodesExplored = 0;
     executionTime = 0.0;
@@ -31,82 +40,172 @@ std::vector<int64_t> DijkstraAlgorithm::findPath(
         throw GraphException("End node not found in graph");
     }
 
-    // Dijkstra's algorithm initialization
-    std::unordered_map<int64_t, double> distances;
-    std::unordered_map<int64_t, int64_t> previousEdge;
-    std::unordered_set<int64_t> visitedNodes;
-    std::priority_queue<QueueNode, std::vector<QueueNode>, std::greater<QueueNode>> priorityQueue;
+    std::vector<int64_t> path;
+
+    // Routing runs on the frozen CSR snapshot (no hashing or copies per relaxation)
+    auto csr = graph.getCsrGraph();
+    if (!csr) {
+        return path; // Adjacency not built = no route
+    }
+
+    uint32_t startIdx = csr->getNodeIndex(startNodeId);
+    uint32_t endIdx = csr->getNodeIndex(endNodeId);
+    if (startIdx == CsrGraph::INVALID_INDEX || endIdx == CsrGraph::INVALID_INDEX) {
+        return path; // Node added after the snapshot = not connected
+    }
+
+    // Vehicle restrictions resolved once per query (one flag per road class)
+    std::vector<char> blockedClasses;
+    if (vehicleProfile != nullptr) {
+        blockedClasses = vehicleProfile->getBlockedRoadClasses(csr->getRoadClasses());
+    }
 
-    // OPTIMIZATION: Do not initialize ALL nodes, only those we explore
-    // Reserve estimated space to avoid reallocations
-    distances.reserve(10000);
-    previousEdge.reserve(10000);
-    visitedNodes.reserve(10000);
+    // Dijkstra's algorithm
+    workspace.reset(csr->getNodeCount());
+    workspace.markTarget(endIdx);
+    runSearch(*csr, startIdx, 1, blockedClasses, workspace);
+    
+    // If end node was not reached
+    if (!workspace.isReached(endIdx)) {
+        return path; // Empty path = no route found
+    }
     
-    distances[startNodeId] = 0.0;
-    priorityQueue.push({startNodeId, 0.0});
+    return buildPath(*csr, startIdx, endIdx, workspace);
+}
 
-    // Main loop
-    while (!priorityQueue.empty()) {
-        QueueNode current = priorityQueue.top();
-        priorityQueue.pop();
+std::shared_ptr<const CsrGraph> DijkstraAlgorithm::searchToMany(
+    const Graph& graph,
+    int64_t startNodeId,
+    const std::vector<int64_t>& targetNodeIds,
+    const VehicleProfile* vehicleProfile,
+    SearchWorkspace& workspace,
+    uint32_t& startIdx,
+    std::vector<uint32_t>& targetIdx
+) {
+    nodesExplored = 0;
+    executionTime = 0.0;
 
-        if (visitedNodes.count(current.nodeId) > 0) {
-            continue; // Already processed
+    if (!graph.hasNode(startNodeId)) {
+        throw GraphException("Start node not found in graph");
+    }
+    for (int64_t targetNodeId : targetNodeIds) {
+        if (!graph.hasNode(targetNodeId)) {
+            throw GraphException("End node not found in graph");
         }
-        visitedNodes.insert(current.nodeId);
-        nodesExplored++;
+    }
 
-        // If we reached the destination
-        if (current.nodeId == endNodeId) {
-            break;
+    auto csr = graph.getCsrGraph();
+    if (!csr) {
+        return nullptr;
+    }
+
+    startIdx = csr->getNodeIndex(startNodeId);
+    if (startIdx == CsrGraph::INVALID_INDEX) {
+        return nullptr;
+    }
+
+    std::vector<char> blockedClasses;
+    if (vehicleProfile != nullptr) {
+        blockedClasses = vehicleProfile->getBlockedRoadClasses(csr->getRoadClasses());
+    }
+
+    // Mark the distinct targets, then run one search until all of them are settled
+    workspace.reset(csr->getNodeCount());
+    targetIdx.resize(targetNodeIds.size());
+    size_t targetCount = 0;
+    for (size_t i = 0; i < targetNodeIds.size(); i++) {
+        targetIdx[i] = csr->getNodeIndex(targetNodeIds[i]);
+        if (targetIdx[i] != CsrGraph::INVALID_INDEX && workspace.markTarget(targetIdx[i])) {
+            targetCount++;
         }
+    }
+    runSearch(*csr, startIdx, targetCount, blockedClasses, workspace);
+    return csr;
+}
 
-        // Explore neighbors
-        std::vector<Edge*> outgoingEdges = graph.getOutgoingEdges(current.nodeId);
-        
-        for (Edge* edge : outgoingEdges) {
-            if (vehicleProfile != nullptr && isEdgeRestrictedForVehicle(*edge, vehicleProfile)) {
-                continue; // Skip restricted edges
-            }
+std::vector<std::vector<int64_t>> DijkstraAlgorithm::findPathsToMany(
+    const Graph& graph,
+    int64_t startNodeId,
+    const std::vector<int64_t>& targetNodeIds,
+    const VehicleProfile* vehicleProfile,
+    SearchWorkspace& workspace
+) {
+    std::vector<std::vector<int64_t>> paths(targetNodeIds.size());
 
-            int64_t neighborId = edge->getTarget()->getId();
-            double newDist = distances[current.nodeId] + edge->getDistance().getMeters();
+    uint32_t startIdx;
+    std::vector<uint32_t> targetIdx;
+    auto csr = searchToMany(graph, startNodeId, targetNodeIds, vehicleProfile, workspace, startIdx, targetIdx);
+    if (!csr) {
+        return paths;
+    }
 
-            // OPTIMIZATION: Only check if it does not exist or is better
-            auto it = distances.find(neighborId);
-            if (it == distances.end() || newDist < it->second) {
-                distances[neighborId] = newDist;
-                previousEdge[neighborId] = edge->getId();
-                priorityQueue.push({neighborId, newDist});
-            }
+    for (size_t i = 0; i < targetIdx.size(); i++) {
+        if (targetIdx[i] != CsrGraph::INVALID_INDEX && workspace.isReached(targetIdx[i])) {
+            paths[i] = buildPath(*csr, startIdx, targetIdx[i], workspace);
         }
     }
-    
-    // Reconstruct path
-    std::vector<int64_t> path;
-    
-    // If end node was not reached
-    if (previousEdge.find(endNodeId) == previousEdge.end() && startNodeId != endNodeId) {
-        return path; // Empty path = no route found
+    return paths;
+}
+
+bool DijkstraAlgorithm::findDistancesToMany(
+    const Graph& graph,
+    int64_t startNodeId,
+    const std::vector<int64_t>& targetNodeIds,
+    const VehicleProfile* vehicleProfile,
+    SearchWorkspace& workspace,
+    std::vector<double>& distances
+) {
+    distances.assign(targetNodeIds.size(), std::numeric_limits<double>::infinity());
+
+    uint32_t startIdx;
+    std::vector<uint32_t> targetIdx;
+    if (!searchToMany(graph, startNodeId, targetNodeIds, vehicleProfile, workspace, startIdx, targetIdx)) {
+        return true;
     }
-    
-    // Build path backwards
-    int64_t currentNode = endNodeId;
-    while (currentNode != startNodeId) {
-        auto it = previousEdge.find(currentNode);
-        if (it == previousEdge.end()) {
-            break;
+
+    for (size_t i = 0; i < targetIdx.size(); i++) {
+        if (targetIdx[i] != CsrGraph::INVALID_INDEX) {
+            distances[i] = workspace.getDistance(targetIdx[i]);
         }
-        
-        int64_t edgeId = it->second;
-        path.push_back(edgeId);
-        
-        Edge* edge = graph.getEdge(edgeId);
-        if (!edge) {
+    }
+    return true;
+}
+
+void DijkstraAlgorithm::runSearch(
+    const CsrGraph& csr,
+    uint32_t startIdx,
+    size_t targetCount,
+    const std::vector<char>& blockedClasses,
+    SearchWorkspace& workspace
+) {
+    // Queue type fixed at compile time per instantiation
+    switch (queueKind) {
+        case QueueKind::BinaryHeap:
+            search<LazyBinaryHeap>(csr, startIdx, targetCount, blockedClasses, workspace);
             break;
-        }
-        currentNode = edge->getSource()->getId();
+        case QueueKind::RadixHeap:
+            search<RadixHeap>(csr, startIdx, targetCount, blockedClasses, workspace);
+            break;
+        default:
+            search<IndexedDaryHeap<4>>(csr, startIdx, targetCount, blockedClasses, workspace);
+            break;
+    }
+}
+
+std::vector<int64_t> DijkstraAlgorithm::buildPath(
+    const CsrGraph& csr,
+    uint32_t startIdx,
+    uint32_t targetIdx,
+    const SearchWorkspace& workspace
+) {
+    std::vector<int64_t> path;
+
+    // Build path backwards
+    uint32_t currentNode = targetIdx;
+    while (currentNode != startIdx) {
+        uint32_t arc = workspace.getParentArc(currentNode);
+        path.push_back(csr.getArcEdgeId(arc));
+        currentNode = csr.getArcSource(arc);
     }
     
     // Reverse to get correct order (start -> end)
@@ -115,6 +214,59 @@ std::vector<int64_t> DijkstraAlgorithm::findPath(
     return path;
 }
 
+template <class Queue>
+void DijkstraAlgorithm::search(
+    const CsrGraph& csr,
+    uint32_t startIdx,
+    size_t targetCount,
+    const std::vector<char>& blockedClasses,
+    SearchWorkspace& workspace
+) {
+    if (targetCount == 0) {
+        return;
+    }
+
+    Queue& queue = workspace.getQueue<Queue>();
+    queue.reset(csr.getNodeCount());
+    
+    workspace.update(startIdx, 0.0, SearchWorkspace::NO_ARC);
+    queue.push(startIdx, 0.0);
+
+    // Main loop
+    while (!queue.empty()) {
+        QueueEntry current = queue.pop();
+
+        if (workspace.isSettled(current.node)) {
+            continue; // Stale entry (lazy heaps only)
+        }
+        workspace.markSettled(current.node);
+        nodesExplored++;
+
+        // Stop once every target is settled
+        if (workspace.isTarget(current.node) && --targetCount == 0) {
+            break;
+        }
+
+        // Explore neighbors (contiguous arc range)
+        double currentDist = workspace.getDistance(current.node);
+        uint32_t arcEnd = csr.arcEnd(current.node);
+        
+        for (uint32_t arc = csr.arcBegin(current.node); arc < arcEnd; arc++) {
+            if (!blockedClasses.empty() && blockedClasses[csr.getArcRoadClass(arc)]) {
+                continue; // Skip restricted edges
+            }
+
+            uint32_t neighborIdx = csr.getArcTarget(arc);
+            double newDist = currentDist + csr.getArcWeight(arc);
+
+            if (newDist < workspace.getDistance(neighborIdx)) {
+                workspace.update(neighborIdx, newDist, arc);
+                queue.push(neighborIdx, newDist);   // Insert or decrease-key
+            }
+        }
+    }
+}
+
 bool DijkstraAlgorithm::isEdgeRestrictedForVehicle(
         const Edge& edge,
         const VehicleProfile* vehicleProfile
@@ -1,23 +1,64 @@
+#pragma once
+
 #include "../../core/interfaces/IPathfindingAlgorithm.h"
 #include "../../core/entities/Graph.h"
 #include "../VehicleProfile.h"
+#include "SearchWorkspace.h"
 
 class DijkstraAlgorithm : public IPathfindingAlgorithm {
 private:
     size_t nodesExplored = 0;
     double executionTime = 0.0;
+    QueueKind queueKind;
+
+    /**
+     * @brief Main loop, instantiated once per priority queue type
+     *
+     * Stops once targetCount nodes marked with workspace.markTarget() are settled.
+     */
+    template <class Queue>
+    void search(
+        const CsrGraph& csr,
+        uint32_t startIdx,
+        size_t targetCount,
+        const std::vector<char>& blockedClasses,
+        SearchWorkspace& workspace
+    );
+
+    void runSearch(
+        const CsrGraph& csr,
+        uint32_t startIdx,
+        size_t targetCount,
+        const std::vector<char>& blockedClasses,
+        SearchWorkspace& workspace
+    );
+
+    /**
+     * @brief Validate ids and run one search from startNodeId until every target is settled
+     *
+     * @return Snapshot searched (nullptr if no search ran: nothing is reachable)
+     */
+    std::shared_ptr<const CsrGraph> searchToMany(
+        const Graph& graph,
+        int64_t startNodeId,
+        const std::vector<int64_t>& targetNodeIds,
+        const VehicleProfile* vehicleProfile,
+        SearchWorkspace& workspace,
+        uint32_t& startIdx,
+        std::vector<uint32_t>& targetIdx
+    );
 
-    struct QueueNode {
-        int64_t nodeId;
-        double cost;
-        
-        bool operator>(const QueueNode& other) const {
-            return cost > other.cost;
-        }
-    };
+    // Edge ids along the parent tree from startIdx to targetIdx (target must be reached)
+    static std::vector<int64_t> buildPath(
+        const CsrGraph& csr,
+        uint32_t startIdx,
+        uint32_t targetIdx,
+        const SearchWorkspace& workspace
+    );
 
 public:
-    DijkstraAlgorithm() : nodesExplored(0), executionTime(0.0) {}
+    explicit DijkstraAlgorithm(QueueKind queueKind = DEFAULT_QUEUE_KIND)
+        : nodesExplored(0), executionTime(0.0), queueKind(queueKind) {}
 
     std::vector<int64_t> findPath(
         const Graph& graph, 
@@ -32,11 +73,47 @@ public:
         const VehicleProfile* vehicleProfile
     ) override;
 
+    std::vector<int64_t> findPath(
+        const Graph& graph, 
+        int64_t startNodeId, 
+        int64_t endNodeId,
+        const VehicleProfile* vehicleProfile,
+        SearchWorkspace& workspace
+    ) override;
+
+    /**
+     * @brief One Dijkstra from startNodeId, stopped once every target is settled
+     *
+     * The paths are read off the shortest-path tree, so a row of n targets
+     * costs one search instead of n.
+     */
+    std::vector<std::vector<int64_t>> findPathsToMany(
+        const Graph& graph,
+        int64_t startNodeId,
+        const std::vector<int64_t>& targetNodeIds,
+        const VehicleProfile* vehicleProfile,
+        SearchWorkspace& workspace
+    ) override;
+
+    /**
+     * @brief Same search, reading only the distances (no path is built)
+     */
+    bool findDistancesToMany(
+        const Graph& graph,
+        int64_t startNodeId,
+        const std::vector<int64_t>& targetNodeIds,
+        const VehicleProfile* vehicleProfile,
+        SearchWorkspace& workspace,
+        std::vector<double>& distances
+    ) override;
+
     bool isEdgeRestrictedForVehicle(
         const Edge& edge,
         const VehicleProfile* vehicleProfile
     ) const;
 
+    QueueKind getQueueKind() const { return queueKind; }
+
     std::string getName() const override { return "dijkstra"; }
     size_t getNodesExplored() const override { return nodesExplored; }
     double getExecutionTime() const override { return executionTime; }
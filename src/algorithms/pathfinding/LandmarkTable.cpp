@@ -0,0 +1,297 @@
+#include "LandmarkTable.h"
+#include "PriorityQueues.h"
+#include <algorithm>
+#include <limits>
+#include <random>
+
+namespace {
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+constexpr uint32_t NO_NODE = 0xFFFFFFFFu;
+
+/**
+ * @brief Full one-to-all Dijkstra (reverse = over incoming arcs, i.e. d(v, source))
+ */
+void runDijkstra(
+    const CsrGraph& csr,
+    uint32_t source,
+    const std::vector<char>& blockedClasses,
+    bool reverse,
+    IndexedDaryHeap<4>& queue,
+    std::vector<double>& distance,
+    std::vector<uint32_t>* order = nullptr,
+    std::vector<uint32_t>* parent = nullptr
+) {
+    const size_t n = csr.getNodeCount();
+    distance.assign(n, INF);
+    if (order) order->clear();
+    if (parent) parent->assign(n, NO_NODE);
+
+    queue.reset(n);
+    distance[source] = 0.0;
+    queue.push(source, 0.0);
+
+    while (!queue.empty()) {
+        QueueEntry current = queue.pop();
+        if (order) order->push_back(current.node);
+
+        uint32_t begin = reverse ? csr.inArcBegin(current.node) : csr.arcBegin(current.node);
+        uint32_t end = reverse ? csr.inArcEnd(current.node) : csr.arcEnd(current.node);
+
+        for (uint32_t i = begin; i < end; i++) {
+            uint32_t arc = reverse ? csr.getInArc(i) : i;
+            if (!blockedClasses.empty() && blockedClasses[csr.getArcRoadClass(arc)]) {
+                continue;
+            }
+
+            uint32_t neighbor = reverse ? csr.getArcSource(arc) : csr.getArcTarget(arc);
+            double newDist = current.key + csr.getArcWeight(arc);
+            if (newDist < distance[neighbor]) {
+                distance[neighbor] = newDist;
+                if (parent) (*parent)[neighbor] = current.node;
+                queue.push(neighbor, newDist);
+            }
+        }
+    }
+}
+
+// Triangle-inequality bound d(v, t) from landmark-major distance rows
+double rowBound(
+    const std::vector<std::vector<double>>& from,
+    const std::vector<std::vector<double>>& to,
+    uint32_t v,
+    uint32_t t
+) {
+    double best = 0.0;
+    for (size_t k = 0; k < from.size(); k++) {
+        double a = from[k][t] - from[k][v];
+        double b = to[k][v] - to[k][t];
+        if (a > best && a < INF) best = a;
+        if (b > best && b < INF) best = b;
+    }
+    return best;
+}
+
+}
+
+LandmarkTable::LandmarkTable(
+    std::string restrictionKey,
+    uint64_t fingerprint,
+    size_t nodeCount,
+    std::vector<uint32_t> landmarks,
+    std::vector<double> fromLandmark,
+    std::vector<double> toLandmark
+) : restrictionKey_(std::move(restrictionKey)),
+    fingerprint_(fingerprint),
+    nodeCount_(nodeCount),
+    landmarks_(std::move(landmarks)),
+    fromLandmark_(std::move(fromLandmark)),
+    toLandmark_(std::move(toLandmark)) {}
+
+std::shared_ptr<const LandmarkTable> LandmarkTable::build(
+    const CsrGraph& csr,
+    const std::vector<char>& blockedClasses,
+    size_t landmarkCount,
+    Selection selection
+) {
+    const size_t n = csr.getNodeCount();
+    landmarkCount = std::min(landmarkCount, n);
+
+    IndexedDaryHeap<4> queue;
+    std::mt19937 rng(static_cast<uint32_t>(n));     // Deterministic: same graph, same landmarks
+    std::uniform_int_distribution<uint32_t> anyNode(0, n > 0 ? static_cast<uint32_t>(n - 1) : 0);
+
+    std::vector<uint32_t> landmarks;
+    std::vector<std::vector<double>> from;          // Landmark-major while building
+    std::vector<std::vector<double>> to;
+    std::vector<char> isLandmark(n, 0);
+
+    std::vector<double> rootDist;
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> parent;
+    std::vector<double> subtreeSize(n);
+    std::vector<char> coveredSubtree(n);
+    std::vector<uint32_t> bestChild(n);
+
+    while (landmarks.size() < landmarkCount) {
+        uint32_t chosen = NO_NODE;
+
+        if (selection == Selection::Avoid && !landmarks.empty()) {
+            // Shortest-path tree from a random root; weight(v) = how badly the
+            // current landmarks bound d(root, v). Descend into the heaviest
+            // subtree that holds no landmark and take its leaf.
+            uint32_t root = anyNode(rng);
+            runDijkstra(csr, root, blockedClasses, false, queue, rootDist, &order, &parent);
+
+            for (uint32_t v : order) {
+                subtreeSize[v] = rootDist[v] - rowBound(from, to, root, v);
+                coveredSubtree[v] = isLandmark[v];
+                bestChild[v] = NO_NODE;
+            }
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                uint32_t v = *it;
+                if (coveredSubtree[v]) subtreeSize[v] = 0.0;
+                uint32_t p = parent[v];
+                if (p == NO_NODE) continue;
+                subtreeSize[p] += subtreeSize[v];
+                coveredSubtree[p] |= coveredSubtree[v];
+                if (subtreeSize[v] > 0.0 &&
+                    (bestChild[p] == NO_NODE || subtreeSize[v] > subtreeSize[bestChild[p]])) {
+                    bestChild[p] = v;
+                }
+            }
+
+            uint32_t w = root;
+            while (bestChild[w] != NO_NODE) w = bestChild[w];
+            if (w != root && !isLandmark[w]) chosen = w;
+        }
+
+        if (chosen == NO_NODE) {
+            // Farthest: maximize the distance to the closest landmark so far
+            // (first landmark: farthest node from a random start)
+            std::vector<double> seedDist;
+            const std::vector<double>* score = nullptr;
+            std::vector<double> minDist;
+            if (landmarks.empty()) {
+                runDijkstra(csr, anyNode(rng), blockedClasses, false, queue, seedDist);
+                score = &seedDist;
+            } else {
+                minDist.assign(n, INF);
+                for (const auto& row : from) {
+                    for (size_t v = 0; v < n; v++) minDist[v] = std::min(minDist[v], row[v]);
+                }
+                score = &minDist;
+            }
+
+            double bestScore = -1.0;
+            for (uint32_t v = 0; v < n; v++) {
+                double d = (*score)[v];
+                if (!isLandmark[v] && d < INF && d > bestScore) {
+                    bestScore = d;
+                    chosen = v;
+                }
+            }
+            if (chosen == NO_NODE) {
+                // Everything reachable is covered: start a new component
+                for (uint32_t v = 0; v < n && chosen == NO_NODE; v++) {
+                    if (!isLandmark[v]) chosen = v;
+                }
+            }
+        }
+
+        isLandmark[chosen] = 1;
+        landmarks.push_back(chosen);
+        from.emplace_back();
+        to.emplace_back();
+        runDijkstra(csr, chosen, blockedClasses, false, queue, from.back());
+        runDijkstra(csr, chosen, blockedClasses, true, queue, to.back());
+    }
+
+    // Transpose to node-major for the query-time lookups
+    const size_t k = landmarks.size();
+    std::vector<double> fromLandmark(n * k);
+    std::vector<double> toLandmark(n * k);
+    for (size_t v = 0; v < n; v++) {
+        for (size_t j = 0; j < k; j++) {
+            fromLandmark[v * k + j] = from[j][v];
+            toLandmark[v * k + j] = to[j][v];
+        }
+    }
+
+    return std::make_shared<const LandmarkTable>(
+        csr.getRestrictionKey(blockedClasses),
+        csr.computeFingerprint(),
+        n,
+        std::move(landmarks),
+        std::move(fromLandmark),
+        std::move(toLandmark)
+    );
+}
+
+double LandmarkTable::lowerBound(uint32_t node, uint32_t target, const std::vector<uint32_t>& active) const {
+    const size_t k = landmarks_.size();
+    const double* fromNode = &fromLandmark_[node * k];
+    const double* toNode = &toLandmark_[node * k];
+    const double* fromTarget = &fromLandmark_[target * k];
+    const double* toTarget = &toLandmark_[target * k];
+
+    // inf - finite = inf is a valid bound (target unreachable); inf - inf = NaN fails both tests
+    double best = 0.0;
+    for (uint32_t j : active) {
+        double a = fromTarget[j] - fromNode[j];
+        double b = toNode[j] - toTarget[j];
+        if (a > best) best = a;
+        if (b > best) best = b;
+    }
+    return best;
+}
+
+std::vector<uint32_t> LandmarkTable::selectActive(uint32_t start, uint32_t target, size_t count) const {
+    std::vector<std::pair<double, uint32_t>> ranked;
+    for (uint32_t j = 0; j < landmarks_.size(); j++) {
+        double bound = lowerBound(start, target, {j});
+        ranked.push_back({bound, j});
+    }
+    std::sort(ranked.begin(), ranked.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    std::vector<uint32_t> active;
+    for (size_t i = 0; i < ranked.size() && i < count; i++) {
+        active.push_back(ranked[i].second);
+    }
+    return active;
+}
+
+void LandmarkStore::bindLocked(const std::shared_ptr<const CsrGraph>& csr) {
+    if (graph_.lock() != csr) {
+        tables_.clear();
+        graph_ = csr;
+    }
+}
+
+std::shared_ptr<const LandmarkTable> LandmarkStore::getOrBuild(
+    const std::shared_ptr<const CsrGraph>& csr,
+    const std::vector<char>& blockedClasses
+) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bindLocked(csr);
+
+    std::string key = csr->getRestrictionKey(blockedClasses);
+    auto it = tables_.find(key);
+    if (it != tables_.end()) {
+        return it->second;
+    }
+
+    // Built under the lock: concurrent queries wait instead of duplicating the work
+    auto table = LandmarkTable::build(*csr, blockedClasses, landmarkCount_, selection_);
+    tables_[key] = table;
+    return table;
+}
+
+bool LandmarkStore::add(const std::shared_ptr<const CsrGraph>& csr, std::shared_ptr<const LandmarkTable> table) {
+    if (!table || table->getNodeCount() != csr->getNodeCount() ||
+        table->getFingerprint() != csr->computeFingerprint()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    bindLocked(csr);
+    tables_[table->getRestrictionKey()] = std::move(table);
+    return true;
+}
+
+std::vector<std::shared_ptr<const LandmarkTable>> LandmarkStore::getTables() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::shared_ptr<const LandmarkTable>> tables;
+    for (const auto& [key, table] : tables_) {
+        tables.push_back(table);
+    }
+    return tables;
+}
+
+void LandmarkStore::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tables_.clear();
+    graph_.reset();
+}
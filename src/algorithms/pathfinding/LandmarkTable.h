@@ -0,0 +1,126 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <map>
+#include <cstdint>
+#include "../../core/entities/CsrGraph.h"
+
+/**
+ * @brief Precomputed landmark distances for ALT (A*, Landmarks, Triangle inequality)
+ *
+ * For every landmark L and node v stores d(L, v) and d(v, L), computed on
+ * the graph restricted to one set of blocked road classes. By the triangle
+ * inequality, for any target t:
+ *   d(v, t) >= d(L, t) - d(L, v)   and   d(v, t) >= d(v, L) - d(t, L)
+ * The max over landmarks is an exact lower bound (and a consistent A*
+ * potential), much tighter than a geometric one on a road network.
+ *
+ * Distances are stored node-major (K values per node contiguous), so one
+ * heuristic evaluation touches a single cache line per array.
+ */
+class LandmarkTable {
+public:
+    enum class Selection {
+        Farthest,   // Node farthest from the landmarks chosen so far
+        Avoid       // Goldberg-Werneck "avoid": leaf of the worst-covered subtree
+    };
+
+    static constexpr size_t DEFAULT_LANDMARK_COUNT = 16;
+
+private:
+    std::string restrictionKey_;            // Blocked road classes the table was built for
+    uint64_t fingerprint_ = 0;              // Graph the table belongs to
+    size_t nodeCount_ = 0;
+    std::vector<uint32_t> landmarks_;       // Dense node indices
+    std::vector<double> fromLandmark_;      // [v * K + k] = d(L_k, v)
+    std::vector<double> toLandmark_;        // [v * K + k] = d(v, L_k)
+
+public:
+    LandmarkTable(
+        std::string restrictionKey,
+        uint64_t fingerprint,
+        size_t nodeCount,
+        std::vector<uint32_t> landmarks,
+        std::vector<double> fromLandmark,
+        std::vector<double> toLandmark
+    );
+
+    /**
+     * @brief Select landmarks and run one forward and one backward Dijkstra per landmark
+     */
+    static std::shared_ptr<const LandmarkTable> build(
+        const CsrGraph& csr,
+        const std::vector<char>& blockedClasses,
+        size_t landmarkCount = DEFAULT_LANDMARK_COUNT,
+        Selection selection = Selection::Avoid
+    );
+
+    const std::string& getRestrictionKey() const { return restrictionKey_; }
+    uint64_t getFingerprint() const { return fingerprint_; }
+    size_t getNodeCount() const { return nodeCount_; }
+    size_t getLandmarkCount() const { return landmarks_.size(); }
+    const std::vector<uint32_t>& getLandmarks() const { return landmarks_; }
+    const std::vector<double>& getFromLandmark() const { return fromLandmark_; }
+    const std::vector<double>& getToLandmark() const { return toLandmark_; }
+
+    double getDistanceFromLandmark(uint32_t node, size_t k) const {
+        return fromLandmark_[node * landmarks_.size() + k];
+    }
+    double getDistanceToLandmark(uint32_t node, size_t k) const {
+        return toLandmark_[node * landmarks_.size() + k];
+    }
+
+    /**
+     * @brief Lower bound on d(node, target) using the given landmark subset
+     */
+    double lowerBound(uint32_t node, uint32_t target, const std::vector<uint32_t>& active) const;
+
+    /**
+     * @brief The count landmarks giving the best bound for (start, target)
+     */
+    std::vector<uint32_t> selectActive(uint32_t start, uint32_t target, size_t count) const;
+};
+
+/**
+ * @brief Thread-safe set of landmark tables for one graph, one per restriction key
+ *
+ * Tables are built on first use and shared by every ALT query. Binding a
+ * different CsrGraph snapshot drops the tables of the previous one.
+ */
+class LandmarkStore {
+private:
+    std::mutex mutex_;
+    std::weak_ptr<const CsrGraph> graph_;
+    std::map<std::string, std::shared_ptr<const LandmarkTable>> tables_;
+    size_t landmarkCount_;
+    LandmarkTable::Selection selection_;
+
+    void bindLocked(const std::shared_ptr<const CsrGraph>& csr);
+
+public:
+    explicit LandmarkStore(
+        size_t landmarkCount = LandmarkTable::DEFAULT_LANDMARK_COUNT,
+        LandmarkTable::Selection selection = LandmarkTable::Selection::Avoid
+    ) : landmarkCount_(landmarkCount), selection_(selection) {}
+
+    /**
+     * @brief Table for csr under the given restrictions (built if missing)
+     */
+    std::shared_ptr<const LandmarkTable> getOrBuild(
+        const std::shared_ptr<const CsrGraph>& csr,
+        const std::vector<char>& blockedClasses
+    );
+
+    /**
+     * @brief Add a table loaded from disk (ignored if its fingerprint does not match csr)
+     */
+    bool add(const std::shared_ptr<const CsrGraph>& csr, std::shared_ptr<const LandmarkTable> table);
+
+    // Snapshot of the current tables (for persistence)
+    std::vector<std::shared_ptr<const LandmarkTable>> getTables();
+
+    void clear();
+};
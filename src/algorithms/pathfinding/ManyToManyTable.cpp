@@ -0,0 +1,123 @@
+#include "ManyToManyTable.h"
+#include "PriorityQueues.h"
+#include <limits>
+#include <algorithm>
+
+namespace {
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+struct BucketEntry {
+    uint32_t node;
+    uint32_t target;
+    double distance;
+};
+
+/**
+ * @brief Exhaustive upward search with stall-on-demand
+ *
+ * forward = follow up edges from source, otherwise down edges reversed.
+ * visit(node, distance) is called for every settled node that is not stalled.
+ */
+template <class Visit>
+void upwardSearch(
+    const ContractionHierarchy& ch,
+    uint32_t source,
+    bool forward,
+    SearchWorkspace& workspace,
+    Visit visit
+) {
+    auto& queue = workspace.getQueue<IndexedDaryHeap<4>>();
+    workspace.reset(ch.getNodeCount());
+    queue.reset(ch.getNodeCount());
+
+    workspace.update(source, 0.0, SearchWorkspace::NO_ARC);
+    queue.push(source, 0.0);
+
+    while (!queue.empty()) {
+        QueueEntry current = queue.pop();
+        workspace.markSettled(current.node);
+
+        // Stalled: a higher node reaches us more cheaply
+        uint32_t stallBegin = forward ? ch.downBegin(current.node) : ch.upBegin(current.node);
+        uint32_t stallEnd = forward ? ch.downEnd(current.node) : ch.upEnd(current.node);
+        bool stalled = false;
+        for (uint32_t i = stallBegin; i < stallEnd && !stalled; i++) {
+            uint32_t edge = forward ? ch.getDownEdge(i) : ch.getUpEdge(i);
+            uint32_t higher = forward ? ch.getEdgeFrom(edge) : ch.getEdgeTo(edge);
+            stalled = workspace.getDistance(higher) + ch.getEdgeWeight(edge) < current.key;
+        }
+        if (stalled) continue;
+
+        visit(current.node, current.key);
+
+        uint32_t relaxBegin = forward ? ch.upBegin(current.node) : ch.downBegin(current.node);
+        uint32_t relaxEnd = forward ? ch.upEnd(current.node) : ch.downEnd(current.node);
+        for (uint32_t i = relaxBegin; i < relaxEnd; i++) {
+            uint32_t edge = forward ? ch.getUpEdge(i) : ch.getDownEdge(i);
+            uint32_t neighborIdx = forward ? ch.getEdgeTo(edge) : ch.getEdgeFrom(edge);
+            double newDist = current.key + ch.getEdgeWeight(edge);
+
+            if (newDist < workspace.getDistance(neighborIdx)) {
+                workspace.update(neighborIdx, newDist, edge);
+                queue.push(neighborIdx, newDist);
+            }
+        }
+    }
+}
+
+}
+
+ManyToManyTable::ManyToManyTable(
+    const ContractionHierarchy& ch,
+    const std::vector<uint32_t>& targets,
+    SearchWorkspace& workspace
+) : ch_(ch), targetCount_(targets.size()) {
+    const size_t n = ch.getNodeCount();
+
+    std::vector<BucketEntry> entries;
+    for (uint32_t column = 0; column < targets.size(); column++) {
+        if (targets[column] == CsrGraph::INVALID_INDEX) continue;
+        upwardSearch(ch, targets[column], false, workspace, [&](uint32_t node, double distance) {
+            entries.push_back({node, column, distance});
+        });
+    }
+
+    // Counting sort by node: bucket of v = [bucketOffsets_[v], bucketOffsets_[v + 1])
+    bucketOffsets_.assign(n + 1, 0);
+    for (const BucketEntry& entry : entries) {
+        bucketOffsets_[entry.node + 1]++;
+    }
+    for (size_t v = 0; v < n; v++) {
+        bucketOffsets_[v + 1] += bucketOffsets_[v];
+    }
+
+    bucketTargets_.resize(entries.size());
+    bucketDistances_.resize(entries.size());
+    std::vector<uint32_t> next(bucketOffsets_.begin(), bucketOffsets_.end() - 1);
+    for (const BucketEntry& entry : entries) {
+        uint32_t slot = next[entry.node]++;
+        bucketTargets_[slot] = entry.target;
+        bucketDistances_[slot] = entry.distance;
+    }
+}
+
+void ManyToManyTable::computeRow(uint32_t source, float* row, SearchWorkspace& workspace) const {
+    std::vector<double> best(targetCount_, INF);
+
+    if (source != CsrGraph::INVALID_INDEX) {
+        upwardSearch(ch_, source, true, workspace, [&](uint32_t node, double distance) {
+            uint32_t end = bucketOffsets_[node + 1];
+            for (uint32_t i = bucketOffsets_[node]; i < end; i++) {
+                double total = distance + bucketDistances_[i];
+                if (total < best[bucketTargets_[i]]) {
+                    best[bucketTargets_[i]] = total;
+                }
+            }
+        });
+    }
+
+    for (size_t column = 0; column < targetCount_; column++) {
+        row[column] = static_cast<float>(best[column]);
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "ContractionHierarchy.h"
+#include "SearchWorkspace.h"
+
+/**
+ * @brief Bucket-based many-to-many distances on a Contraction Hierarchy
+ *
+ * Every shortest path in a CH climbs from the source and then descends to
+ * the target, so d(s, t) = min over v of up(s, v) + up_rev(t, v):
+ * - Build: one backward upward search per target t leaves an entry
+ *   (t, distance) in the bucket of every node it settles.
+ * - Row: one forward upward search from s scans the bucket of every node
+ *   it settles and keeps the minimum per target.
+ * S x T distances therefore cost S + T upward searches (a few hundred
+ * nodes each) instead of S x T full queries. Stalled nodes are skipped on
+ * both sides: their tentative distance is not a shortest one.
+ *
+ * Buckets are read-only once built, so rows can be computed concurrently
+ * (one SearchWorkspace per thread).
+ *
+ * Reference: Knopp, Sanders, Schultes, Schulz, Wagner, "Computing
+ * Many-to-Many Shortest Paths Using Highway Hierarchies" (ALENEX 2007)
+ */
+class ManyToManyTable {
+private:
+    const ContractionHierarchy& ch_;
+    size_t targetCount_;
+
+    // Buckets grouped by node (bucketOffsets_ has N + 1 entries)
+    std::vector<uint32_t> bucketOffsets_;
+    std::vector<uint32_t> bucketTargets_;       // Column of the target
+    std::vector<double> bucketDistances_;       // d(node, target)
+
+public:
+    /**
+     * @brief Run the backward searches and fill the buckets
+     *
+     * @param targets Hierarchy node index per column (CsrGraph::INVALID_INDEX = unreachable column)
+     */
+    ManyToManyTable(
+        const ContractionHierarchy& ch,
+        const std::vector<uint32_t>& targets,
+        SearchWorkspace& workspace
+    );
+
+    size_t getTargetCount() const { return targetCount_; }
+    size_t getBucketEntryCount() const { return bucketTargets_.size(); }
+
+    /**
+     * @brief Distances from source to every target (infinity = unreachable)
+     *
+     * @param row Output, getTargetCount() values
+     */
+    void computeRow(uint32_t source, float* row, SearchWorkspace& workspace) const;
+};
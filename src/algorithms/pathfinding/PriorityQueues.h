@@ -0,0 +1,291 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Priority queues for the pathfinding algorithms
+ *
+ * All queues share the same interface, so the search loops are templates
+ * over the queue type (selected at compile time):
+ * - reset(nodeCount)   Prepare for a new query (keeps allocations)
+ * - push(node, key)    Insert, or decrease the key if the node is queued
+ * - pop()              Remove and return the minimum entry
+ * - top()              Minimum entry without removing it (may be stale
+ *                      in the lazy heaps: its key is then only a lower bound)
+ * - empty() / size()
+ *
+ * Variants:
+ * - LazyBinaryHeap     std heap with lazy deletion (duplicates on improve)
+ * - IndexedDaryHeap<D> D-ary heap with true decrease-key (no duplicates)
+ * - RadixHeap          Monotone radix heap (Dijkstra only: pushed keys must
+ *                      never be below the last popped key)
+ */
+
+struct QueueEntry {
+    uint32_t node;
+    double key;
+
+    bool operator>(const QueueEntry& other) const {
+        return key > other.key;
+    }
+};
+
+enum class QueueKind {
+    BinaryHeap,
+    FourAryHeap,
+    RadixHeap
+};
+
+// Default queue, chosen at build time (CMake option OEP_PATHFINDING_QUEUE)
+#if defined(OEP_PATHFINDING_QUEUE_BINARY)
+constexpr QueueKind DEFAULT_QUEUE_KIND = QueueKind::BinaryHeap;
+#elif defined(OEP_PATHFINDING_QUEUE_RADIX)
+constexpr QueueKind DEFAULT_QUEUE_KIND = QueueKind::RadixHeap;
+#else
+constexpr QueueKind DEFAULT_QUEUE_KIND = QueueKind::FourAryHeap;
+#endif
+
+inline const char* queueKindName(QueueKind kind) {
+    switch (kind) {
+        case QueueKind::BinaryHeap: return "binary";
+        case QueueKind::FourAryHeap: return "4-ary";
+        case QueueKind::RadixHeap: return "radix";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Binary heap with lazy deletion (previous behavior)
+ *
+ * push() always appends, so an improved node leaves a stale entry behind;
+ * callers skip it on pop because the node is already settled.
+ */
+class LazyBinaryHeap {
+public:
+    static constexpr bool REQUIRES_MONOTONE_KEYS = false;
+
+private:
+    std::vector<QueueEntry> heap_;
+
+public:
+    void reset(size_t) { heap_.clear(); }
+    bool empty() const { return heap_.empty(); }
+    size_t size() const { return heap_.size(); }
+
+    void push(uint32_t node, double key) {
+        heap_.push_back({node, key});
+        std::push_heap(heap_.begin(), heap_.end(), std::greater<QueueEntry>());
+    }
+
+    QueueEntry top() const { return heap_.front(); }
+
+    QueueEntry pop() {
+        std::pop_heap(heap_.begin(), heap_.end(), std::greater<QueueEntry>());
+        QueueEntry top = heap_.back();
+        heap_.pop_back();
+        return top;
+    }
+};
+
+/**
+ * @brief Indexed D-ary min-heap with decrease-key
+ *
+ * position_[node] tracks where each queued node lives, so an improvement
+ * moves the existing entry up instead of pushing a duplicate. The heap
+ * never holds more entries than the current frontier. With D = 4 a node's
+ * children share one cache line and the tree is half as deep as binary.
+ */
+template <unsigned D>
+class IndexedDaryHeap {
+public:
+    static constexpr bool REQUIRES_MONOTONE_KEYS = false;
+    static constexpr uint32_t NOT_IN_HEAP = 0xFFFFFFFFu;
+
+private:
+    std::vector<QueueEntry> heap_;
+    std::vector<uint32_t> position_;
+
+    void place(size_t i, const QueueEntry& entry) {
+        heap_[i] = entry;
+        position_[entry.node] = static_cast<uint32_t>(i);
+    }
+
+    void siftUp(size_t i) {
+        QueueEntry entry = heap_[i];
+        while (i > 0) {
+            size_t parent = (i - 1) / D;
+            if (!(heap_[parent].key > entry.key)) break;
+            place(i, heap_[parent]);
+            i = parent;
+        }
+        place(i, entry);
+    }
+
+    void siftDown(size_t i) {
+        QueueEntry entry = heap_[i];
+        const size_t count = heap_.size();
+        while (true) {
+            size_t first = i * D + 1;
+            if (first >= count) break;
+            size_t last = std::min(first + D, count);
+            size_t best = first;
+            for (size_t c = first + 1; c < last; c++) {
+                if (heap_[c].key < heap_[best].key) best = c;
+            }
+            if (!(entry.key > heap_[best].key)) break;
+            place(i, heap_[best]);
+            i = best;
+        }
+        place(i, entry);
+    }
+
+public:
+    // O(queued entries) unless the node count changed
+    void reset(size_t nodeCount) {
+        if (position_.size() != nodeCount) {
+            position_.assign(nodeCount, NOT_IN_HEAP);
+        } else {
+            for (const QueueEntry& entry : heap_) position_[entry.node] = NOT_IN_HEAP;
+        }
+        heap_.clear();
+    }
+
+    bool empty() const { return heap_.empty(); }
+    size_t size() const { return heap_.size(); }
+
+    void push(uint32_t node, double key) {
+        uint32_t pos = position_[node];
+        if (pos == NOT_IN_HEAP) {
+            heap_.push_back({node, key});
+            siftUp(heap_.size() - 1);
+        } else if (key < heap_[pos].key) {
+            heap_[pos].key = key;
+            siftUp(pos);
+        }
+    }
+
+    QueueEntry top() const { return heap_.front(); }
+
+    QueueEntry pop() {
+        QueueEntry top = heap_.front();
+        position_[top.node] = NOT_IN_HEAP;
+
+        QueueEntry last = heap_.back();
+        heap_.pop_back();
+        if (!heap_.empty()) {
+            place(0, last);
+            siftDown(0);
+        }
+        return top;
+    }
+};
+
+/**
+ * @brief Monotone radix heap (lazy, integer keys)
+ *
+ * Keys are the IEEE-754 bit patterns of the (non-negative) distances,
+ * which order exactly like the doubles, so no precision is lost. Entry
+ * buckets are indexed by the highest bit where the key differs from the
+ * last popped key; each entry moves down at most 64 times in total.
+ * Only valid when keys are monotone (Dijkstra with non-negative weights).
+ */
+class RadixHeap {
+public:
+    static constexpr bool REQUIRES_MONOTONE_KEYS = true;
+
+private:
+    struct Item {
+        uint64_t key;
+        uint32_t node;
+    };
+
+    std::vector<Item> buckets_[65];
+    uint64_t last_ = 0;
+    size_t size_ = 0;
+
+    static uint64_t toBits(double key) {
+        uint64_t bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        return bits;
+    }
+
+    static double fromBits(uint64_t bits) {
+        double key;
+        std::memcpy(&key, &bits, sizeof(key));
+        return key;
+    }
+
+    static size_t bucketOf(uint64_t key, uint64_t last) {
+        uint64_t diff = key ^ last;
+        if (diff == 0) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+        return 64 - static_cast<size_t>(__builtin_clzll(diff));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, diff);
+        return static_cast<size_t>(index) + 1;
+#else
+        size_t bits = 0;
+        while (diff) { diff >>= 1; bits++; }
+        return bits;
+#endif
+    }
+
+public:
+    void reset(size_t) {
+        for (auto& bucket : buckets_) bucket.clear();
+        last_ = 0;
+        size_ = 0;
+    }
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    void push(uint32_t node, double key) {
+        uint64_t bits = toBits(key);
+        assert(bits >= last_ && "RadixHeap requires monotone keys");
+        buckets_[bucketOf(bits, last_)].push_back({bits, node});
+        size_++;
+    }
+
+    // Not const: may redistribute the first non-empty bucket into bucket 0
+    QueueEntry top() {
+        refill();
+        const Item& item = buckets_[0].back();
+        return {item.node, fromBits(item.key)};
+    }
+
+    QueueEntry pop() {
+        refill();
+        Item item = buckets_[0].back();
+        buckets_[0].pop_back();
+        size_--;
+        return {item.node, fromBits(item.key)};
+    }
+
+private:
+    // Move the smallest non-empty bucket down so bucket 0 holds the minimum
+    void refill() {
+        if (!buckets_[0].empty()) return;
+
+        size_t i = 1;
+        while (buckets_[i].empty()) i++;
+
+        uint64_t minKey = buckets_[i][0].key;
+        for (const Item& item : buckets_[i]) minKey = std::min(minKey, item.key);
+        last_ = minKey;
+
+        for (const Item& item : buckets_[i]) {
+            buckets_[bucketOf(item.key, last_)].push_back(item);
+        }
+        buckets_[i].clear();
+    }
+};
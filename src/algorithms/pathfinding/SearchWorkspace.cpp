@@ -0,0 +1,49 @@
+#include "SearchWorkspace.h"
+#include <algorithm>
+
+void SearchWorkspace::reset(size_t nodeCount) {
+    if (distance_.size() != nodeCount) {
+        distance_.assign(nodeCount, 0.0);
+        parentArc_.assign(nodeCount, NO_ARC);
+        reachedStamp_.assign(nodeCount, 0);
+        settledStamp_.assign(nodeCount, 0);
+        targetStamp_.assign(nodeCount, 0);
+        generation_ = 1;
+        return;
+    }
+
+    // Generation wrapped around: stale stamps could match again, clear them once
+    if (++generation_ == 0) {
+        std::fill(reachedStamp_.begin(), reachedStamp_.end(), 0);
+        std::fill(settledStamp_.begin(), settledStamp_.end(), 0);
+        std::fill(targetStamp_.begin(), targetStamp_.end(), 0);
+        generation_ = 1;
+    }
+}
+
+SearchWorkspace& SearchWorkspace::getBackward() {
+    if (!backward_) {
+        backward_ = std::make_unique<SearchWorkspace>();
+    }
+    return *backward_;
+}
+
+SearchWorkspacePool::Lease SearchWorkspacePool::acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (idle_.empty()) {
+        return Lease(this, std::make_unique<SearchWorkspace>());
+    }
+    auto workspace = std::move(idle_.back());
+    idle_.pop_back();
+    return Lease(this, std::move(workspace));
+}
+
+void SearchWorkspacePool::release(std::unique_ptr<SearchWorkspace> workspace) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_.push_back(std::move(workspace));
+}
+
+void SearchWorkspacePool::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_.clear();
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <limits>
+#include <cstdint>
+#include <tuple>
+#include "PriorityQueues.h"
+
+/**
+ * @brief Reusable per-thread state for one search over a CsrGraph
+ *
+ * Owns distance, parent-arc and settled arrays sized to the graph. Entries
+ * are tagged with the generation that wrote them, so reset() between
+ * queries is O(1): bumping the generation invalidates every entry at once.
+ * Arrays are only (re)allocated when the node count changes. One instance
+ * of each priority queue lives here too, so heaps keep their capacity.
+ *
+ * A workspace is NOT thread-safe: one thread uses it at a time (see
+ * SearchWorkspacePool, or keep one per worker thread).
+ */
+class SearchWorkspace {
+public:
+    static constexpr uint32_t NO_ARC = 0xFFFFFFFFu;
+
+private:
+    std::vector<double> distance_;
+    std::vector<uint32_t> parentArc_;
+    std::vector<uint32_t> reachedStamp_;    // Generation that last wrote distance/parent
+    std::vector<uint32_t> settledStamp_;    // Generation that settled the node
+    std::vector<uint32_t> targetStamp_;     // Generation that marked the node as a target
+    uint32_t generation_ = 0;
+
+    std::tuple<LazyBinaryHeap, IndexedDaryHeap<4>, RadixHeap> queues_;
+
+    std::unique_ptr<SearchWorkspace> backward_;     // Created on first use
+
+public:
+    /**
+     * @brief Prepare for a new query on a graph with nodeCount nodes
+     */
+    void reset(size_t nodeCount);
+
+    size_t getNodeCount() const { return distance_.size(); }
+
+    bool isReached(uint32_t node) const { return reachedStamp_[node] == generation_; }
+
+    double getDistance(uint32_t node) const {
+        return isReached(node) ? distance_[node] : std::numeric_limits<double>::infinity();
+    }
+
+    uint32_t getParentArc(uint32_t node) const {
+        return isReached(node) ? parentArc_[node] : NO_ARC;
+    }
+
+    void update(uint32_t node, double distance, uint32_t parentArc) {
+        distance_[node] = distance;
+        parentArc_[node] = parentArc;
+        reachedStamp_[node] = generation_;
+    }
+
+    bool isSettled(uint32_t node) const { return settledStamp_[node] == generation_; }
+    void markSettled(uint32_t node) { settledStamp_[node] = generation_; }
+
+    // Targets of a one-to-many search (false if the node was already marked)
+    bool markTarget(uint32_t node) {
+        if (targetStamp_[node] == generation_) return false;
+        targetStamp_[node] = generation_;
+        return true;
+    }
+    bool isTarget(uint32_t node) const { return targetStamp_[node] == generation_; }
+
+    // Reusable queue of the given type (caller resets it per query)
+    template <class Queue>
+    Queue& getQueue() { return std::get<Queue>(queues_); }
+
+    // Second workspace for the backward half of bidirectional searches
+    SearchWorkspace& getBackward();
+};
+
+/**
+ * @brief Thread-safe free list of SearchWorkspaces
+ *
+ * acquire() hands out an idle workspace (or a new one) and the Lease gives
+ * it back on destruction, so the pool grows to the number of threads that
+ * search concurrently and then stops allocating.
+ */
+class SearchWorkspacePool {
+private:
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<SearchWorkspace>> idle_;
+
+    void release(std::unique_ptr<SearchWorkspace> workspace);
+
+public:
+    class Lease {
+    private:
+        SearchWorkspacePool* pool_;
+        std::unique_ptr<SearchWorkspace> workspace_;
+
+    public:
+        Lease(SearchWorkspacePool* pool, std::unique_ptr<SearchWorkspace> workspace)
+            : pool_(pool), workspace_(std::move(workspace)) {}
+        Lease(Lease&&) = default;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease() {
+            if (workspace_) pool_->release(std::move(workspace_));
+        }
+
+        SearchWorkspace& operator*() const { return *workspace_; }
+        SearchWorkspace* operator->() const { return workspace_.get(); }
+    };
+
+    Lease acquire();
+
+    // Drop idle workspaces (e.g. after loading a different graph)
+    void clear();
+};
@@ -0,0 +1,374 @@
+#include "CandidateLocalSearch.h"
+#include <algorithm>
+
+CandidateLocalSearch::CandidateLocalSearch(
+    const TspMatrix& matrix,
+    const NeighborLists& neighbors,
+    bool returnToStart,
+    bool fixFirst
+)
+    : matrix_(matrix)
+    , neighbors_(neighbors)
+    , returnToStart_(returnToStart)
+    , fixFirst_(fixFirst)
+    , evaluator_(matrix, returnToStart)
+    , position_(matrix.getSize(), 0)
+    , active_(matrix.getSize(), 0)
+    , usedStamp_(matrix.getSize(), 0)
+    , chainStamp_(0)
+{}
+
+double CandidateLocalSearch::run(std::vector<int>& route, int moves) {
+    refresh(route);
+
+    queue_.clear();
+    std::fill(active_.begin(), active_.end(), 0);
+    for (int city : route) {
+        active_[city] = 1;
+        queue_.push_back(city);
+    }
+    return search(route, moves);
+}
+
+double CandidateLocalSearch::run(std::vector<int>& route, int moves, const std::vector<int>& activeCities) {
+    refresh(route);
+
+    queue_.clear();
+    std::fill(active_.begin(), active_.end(), 0);
+    for (int city : activeCities) {
+        if (!active_[city]) {
+            active_[city] = 1;
+            queue_.push_back(city);
+        }
+    }
+    return search(route, moves);
+}
+
+double CandidateLocalSearch::search(std::vector<int>& route, int moves) {
+    while (!queue_.empty()) {
+        int city = queue_.front();
+        queue_.pop_front();
+        active_[city] = 0;
+
+        if (improveCity(route, city, moves)) {
+            // The city may have more to gain in its new surroundings
+            if (!active_[city]) {
+                active_[city] = 1;
+                queue_.push_back(city);
+            }
+        }
+    }
+
+    // Re-summed once so rounding in the deltas never accumulates
+    return matrix_.calculateTourCost(route, returnToStart_);
+}
+
+bool CandidateLocalSearch::improveCity(std::vector<int>& route, int city, int moves) {
+    const size_t n = route.size();
+    const int* candidates = neighbors_.get(city);
+
+    if ((moves & LIN_KERNIGHAN) && tryLinKernighan(route, city)) {
+        return true;
+    }
+
+    for (size_t r = 0; r < neighbors_.getK(); r++) {
+        size_t p = position_[city];
+        size_t q = position_[candidates[r]];
+
+        if (moves & SWAP) {
+            // Put city right before / right after its candidate
+            if (q > 0 && trySwap(route, p, q - 1)) return true;
+            if (q + 1 < n && trySwap(route, p, q + 1)) return true;
+        }
+
+        if (moves & TWO_OPT) {
+            // Both reversals that make the pair adjacent
+            size_t lo = std::min(p, q);
+            size_t hi = std::max(p, q);
+            if (tryReverse(route, lo + 1, hi)) return true;
+            if (hi > 0 && tryReverse(route, lo, hi - 1)) return true;
+        }
+
+        if (moves & OR_OPT) {
+            for (size_t len = 1; len <= OR_OPT_MAX_SEGMENT && len + 1 < n; len++) {
+                // Segment starting at city, moved right after the candidate
+                if (p + len <= n && tryOrOpt(route, p, p + len - 1, q)) return true;
+                // Segment ending at city, moved right before the candidate
+                if (p + 1 >= len && q > 0 && tryOrOpt(route, p + 1 - len, p, q - 1)) return true;
+            }
+        }
+
+        if ((moves & OR_3OPT) && tryOr3Opt(route, city, candidates[r])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CandidateLocalSearch::trySwap(std::vector<int>& route, size_t x, size_t y) {
+    if (x == y || (fixFirst_ && (x == 0 || y == 0))) {
+        return false;
+    }
+    if (evaluator_.swapDelta(route, x, y) >= -TourMoveEvaluator::IMPROVEMENT_EPSILON) {
+        return false;
+    }
+
+    long a = static_cast<long>(x);
+    long b = static_cast<long>(y);
+    activate(route, {a - 1, a, a + 1, b - 1, b, b + 1});
+    std::swap(route[x], route[y]);
+    position_[route[x]] = x;
+    position_[route[y]] = y;
+    evaluator_.update(route);
+    return true;
+}
+
+bool CandidateLocalSearch::tryReverse(std::vector<int>& route, size_t i, size_t j) {
+    if (i >= j || (fixFirst_ && i == 0)) {
+        return false;
+    }
+    if (evaluator_.reverseDelta(route, i, j) >= -TourMoveEvaluator::IMPROVEMENT_EPSILON) {
+        return false;
+    }
+
+    long a = static_cast<long>(i);
+    long b = static_cast<long>(j);
+    activate(route, {a - 1, a, b, b + 1});
+    std::reverse(route.begin() + i, route.begin() + j + 1);
+    refresh(route, i, j);
+    return true;
+}
+
+bool CandidateLocalSearch::tryOrOpt(std::vector<int>& route, size_t i, size_t last, size_t j) {
+    const size_t n = route.size();
+    if (fixFirst_ && i == 0) {
+        return false;
+    }
+    // Insertion point must lie outside the segment and not right before it
+    if (j + 1 >= i && j <= last) {
+        return false;
+    }
+    if (returnToStart_ && i == 0 && j == n - 1) {
+        return false;
+    }
+    if (evaluator_.orOptDelta(route, i, last, j) >= -TourMoveEvaluator::IMPROVEMENT_EPSILON) {
+        return false;
+    }
+
+    long a = static_cast<long>(i);
+    long b = static_cast<long>(last);
+    long c = static_cast<long>(j);
+    activate(route, {a - 1, a, b, b + 1, c, c + 1});
+    if (j > last) {
+        std::rotate(route.begin() + i, route.begin() + last + 1, route.begin() + j + 1);
+        refresh(route, i, j);
+    } else {
+        std::rotate(route.begin() + j + 1, route.begin() + i, route.begin() + last + 1);
+        refresh(route, j + 1, last);
+    }
+    return true;
+}
+
+bool CandidateLocalSearch::tryOr3Opt(std::vector<int>& route, int city, int candidate) {
+    const size_t n = route.size();
+    const size_t k = neighbors_.getK();
+    size_t p = position_[city];
+    size_t q = position_[candidate];
+
+    // candidate -> city: segment [p, last] moved right after the candidate,
+    // ending where the gap closes on a candidate leg route[p - 1] -> route[last + 1]
+    if (p > 0) {
+        const int* gapCandidates = neighbors_.get(route[p - 1]);
+        for (size_t r = 0; r < k; r++) {
+            size_t after = position_[gapCandidates[r]];
+            if (after > p && tryOrOpt(route, p, after - 1, q)) return true;
+        }
+    }
+
+    // city -> candidate: segment [first, p] moved right before the candidate,
+    // starting where the gap closes on a candidate leg route[first - 1] -> route[p + 1]
+    if (p + 1 < n && q > 0) {
+        const int* gapCandidates = neighbors_.get(route[p + 1]);
+        for (size_t r = 0; r < k; r++) {
+            size_t before = position_[gapCandidates[r]];
+            if (before < p && tryOrOpt(route, before + 1, p, q - 1)) return true;
+        }
+    }
+    return false;
+}
+
+void CandidateLocalSearch::collectChainSteps(const std::vector<int>& route, int t1, bool forward, double gain) {
+    const size_t n = route.size();
+    steps_.clear();
+
+    // Closed tours are cycles: neighbours wrap around the array
+    size_t p = position_[t1];
+    if (!returnToStart_ && (forward ? p + 1 >= n : p == 0)) {
+        return;
+    }
+    int t2 = route[forward ? (p + 1) % n : (p + n - 1) % n];
+    double closing = forward ? matrix_.getDistance(t1, t2) : matrix_.getDistance(t2, t1);
+
+    const int* candidates = neighbors_.get(t2);
+    for (size_t r = 0; r < neighbors_.getK(); r++) {
+        int t3 = candidates[r];
+        if (usedStamp_[t3] == chainStamp_ || t3 == t2) continue;
+
+        // Gain criterion: the chain must still be able to pay for the new leg
+        double joined = forward ? matrix_.getDistance(t2, t3) : matrix_.getDistance(t3, t2);
+        if (gain + closing - joined <= TourMoveEvaluator::IMPROVEMENT_EPSILON) continue;
+
+        // t4: the tour neighbour of t3 on the side facing t2 (none past an open route end)
+        size_t q = position_[t3];
+        bool hasT4 = returnToStart_ || (forward ? q > 0 : q + 1 < n);
+        size_t q4 = forward ? (q + n - 1) % n : (q + 1) % n;
+        if (hasT4 && route[q4] == t2) continue;  // t2-t3 already adjacent
+
+        // Breaking t1-t2 and t3-t4 and joining t2-t3, t1-t4 reverses the part between
+        // t2 and t4 (or, on a cycle, equivalently the part between t3 and t1)
+        size_t innerFrom = forward ? (p + 1) % n : (q + 1) % n;
+        size_t innerTo = forward ? (q + n - 1) % n : (p + n - 1) % n;
+        size_t outerFrom = forward ? q : p;
+        size_t outerTo = forward ? p : q;
+
+        ChainStep step;
+        if (innerFrom < innerTo && !(fixFirst_ && innerFrom == 0) && (returnToStart_ || hasT4)) {
+            step.from = innerFrom;
+            step.to = innerTo;
+        } else if (outerFrom < outerTo && !(fixFirst_ && outerFrom == 0)) {
+            step.from = outerFrom;
+            step.to = outerTo;
+        } else {
+            continue;
+        }
+
+        step.t3 = t3;
+        step.t4 = hasT4 ? route[q4] : -1;
+        step.delta = evaluator_.reverseDelta(route, step.from, step.to);
+        double broken = 0.0;
+        if (hasT4) {
+            broken = forward ? matrix_.getDistance(step.t4, t3) : matrix_.getDistance(t3, step.t4);
+        }
+        step.lookahead = broken - joined;
+        steps_.push_back(step);
+    }
+
+    std::sort(steps_.begin(), steps_.end(),
+        [](const ChainStep& a, const ChainStep& b) { return a.lookahead > b.lookahead; });
+}
+
+bool CandidateLocalSearch::tryLinKernighan(std::vector<int>& route, int t1) {
+    const size_t n = route.size();
+    if (n < 4) {
+        return false;
+    }
+
+    for (bool startForward : {true, false}) {
+        // forward: t2 follows t1 in the route, otherwise t2 precedes it
+        nextChainStamp();
+        usedStamp_[t1] = chainStamp_;
+        collectChainSteps(route, t1, startForward, 0.0);
+        firstSteps_ = steps_;
+
+        // A few alternatives for the first step, then a single greedy chain each
+        size_t breadth = std::min(LK_BREADTH, firstSteps_.size());
+        for (size_t alternative = 0; alternative < breadth; alternative++) {
+            chain_.clear();
+            chainEnds_.clear();
+            nextChainStamp();
+            usedStamp_[t1] = chainStamp_;
+
+            bool forward = startForward;
+            double gain = 0.0;
+            double bestGain = TourMoveEvaluator::IMPROVEMENT_EPSILON;
+            size_t bestDepth = 0;
+            ChainStep step = firstSteps_[alternative];
+
+            while (true) {
+                long a = static_cast<long>(step.from);
+                long b = static_cast<long>(step.to);
+                const long size = static_cast<long>(n);
+                for (long pos : {a - 1, a, b, b + 1}) {
+                    if (pos >= 0 && pos < size) chainEnds_.push_back(route[pos]);
+                    else chainEnds_.push_back(returnToStart_ ? route[(pos + size) % size] : -1);
+                }
+                std::reverse(route.begin() + step.from, route.begin() + step.to + 1);
+                refresh(route, step.from, step.to);
+                chain_.push_back(step);
+                usedStamp_[step.t3] = chainStamp_;
+                gain -= step.delta;
+
+                if (gain > bestGain) {
+                    bestGain = gain;
+                    bestDepth = chain_.size();
+                }
+
+                // t4 is the new loose end, on whichever side of t1 the reversal left it
+                if (step.t4 < 0) break;
+                size_t p1 = position_[t1];
+                forward = (returnToStart_ || p1 + 1 < n) && route[(p1 + 1) % n] == step.t4;
+                if (chain_.size() >= LK_MAX_DEPTH) break;
+
+                collectChainSteps(route, t1, forward, gain);
+                if (steps_.empty()) break;
+                step = steps_[0];
+            }
+
+            // Roll back the steps after the best prefix (a reversal is its own inverse)
+            if (chain_.size() > bestDepth) {
+                for (size_t k = chain_.size(); k-- > bestDepth;) {
+                    std::reverse(route.begin() + chain_[k].from, route.begin() + chain_[k].to + 1);
+                    refresh(route, chain_[k].from, chain_[k].to);
+                }
+            }
+
+            if (bestDepth > 0) {
+                for (size_t k = 0; k < bestDepth * 4; k++) {
+                    int city = chainEnds_[k];
+                    if (city >= 0 && !active_[city]) {
+                        active_[city] = 1;
+                        queue_.push_back(city);
+                    }
+                }
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void CandidateLocalSearch::nextChainStamp() {
+    if (++chainStamp_ == 0) {
+        std::fill(usedStamp_.begin(), usedStamp_.end(), 0);
+        chainStamp_ = 1;
+    }
+}
+
+void CandidateLocalSearch::activate(const std::vector<int>& route, std::initializer_list<long> positions) {
+    const long n = static_cast<long>(route.size());
+    for (long pos : positions) {
+        if (pos < 0 || pos >= n) {
+            if (!returnToStart_) continue;
+            pos = (pos + n) % n;
+        }
+        int city = route[pos];
+        if (!active_[city]) {
+            active_[city] = 1;
+            queue_.push_back(city);
+        }
+    }
+}
+
+void CandidateLocalSearch::refresh(const std::vector<int>& route) {
+    for (size_t pos = 0; pos < route.size(); pos++) {
+        position_[route[pos]] = pos;
+    }
+    evaluator_.update(route);
+}
+
+void CandidateLocalSearch::refresh(const std::vector<int>& route, size_t from, size_t to) {
+    for (size_t pos = from; pos <= to; pos++) {
+        position_[route[pos]] = pos;
+    }
+    evaluator_.update(route);
+}
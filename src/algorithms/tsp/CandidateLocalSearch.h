@@ -0,0 +1,179 @@
+#pragma once
+
+#include "NeighborLists.h"
+#include "TourMoveEvaluator.h"
+#include "TspMatrix.h"
+#include <deque>
+#include <vector>
+
+/**
+ * @brief Neighbour-list local search with don't-look bits
+ *
+ * Instead of scanning all O(n²) position pairs per pass, each city only
+ * tries moves that make it adjacent to one of its k candidates. Cities
+ * whose surroundings did not change since their last failed scan are
+ * skipped (don't-look bit off); an applied move wakes up the endpoints
+ * of the legs it touched. Moves are evaluated with TourMoveEvaluator and
+ * applied on the first improvement.
+ *
+ * One instance per solve (and per thread): the position / queue buffers
+ * are reused across runs.
+ */
+class CandidateLocalSearch {
+public:
+    /**
+     * @brief Move types, combined as a bit mask
+     */
+    enum Move {
+        SWAP = 1,       // Exchange two cities
+        TWO_OPT = 2,    // Reverse a segment
+        OR_OPT = 4,     // Move a segment of 1-3 cities elsewhere
+        LIN_KERNIGHAN = 8, // Variable-depth chain of 2-opt moves
+        OR_3OPT = 16    // Move a segment of any length elsewhere, same direction
+    };
+
+    /**
+     * @brief Longest segment moved by Or-opt
+     */
+    static constexpr size_t OR_OPT_MAX_SEGMENT = 3;
+
+    /**
+     * @brief Longest chain of 2-opt steps in one Lin-Kernighan move
+     */
+    static constexpr size_t LK_MAX_DEPTH = 50;
+
+    /**
+     * @brief Alternatives tried for the first step of a Lin-Kernighan chain
+     */
+    static constexpr size_t LK_BREADTH = 5;
+
+private:
+    const TspMatrix& matrix_;
+    const NeighborLists& neighbors_;
+    bool returnToStart_;
+    bool fixFirst_;             // Never move the city at position 0
+    TourMoveEvaluator evaluator_;
+
+    std::vector<size_t> position_;  // position_[city] = index in the route
+    std::vector<char> active_;      // Don't-look bits (1 = look at it)
+    std::deque<int> queue_;
+
+    // Lin-Kernighan chain state (reused between moves)
+    struct ChainStep {
+        size_t from;        // Reversed segment [from, to]
+        size_t to;
+        int t3;             // City joined to the loose end
+        int t4;             // Its former neighbour, the next loose end (-1: route end)
+        double delta;       // Exact tour cost change
+        double lookahead;   // Broken leg t3-t4 minus joined leg t2-t3 (ranking)
+    };
+    std::vector<ChainStep> chain_;
+    std::vector<ChainStep> steps_;      // Candidate next steps, best lookahead first
+    std::vector<ChainStep> firstSteps_;
+    std::vector<int> chainEnds_;        // 4 cities per step (-1 past a route end), for waking up
+    std::vector<unsigned> usedStamp_;   // usedStamp_[city] == chainStamp_: already joined in this chain
+    unsigned chainStamp_;
+
+public:
+    /**
+     * @param matrix Distance matrix
+     * @param neighbors Candidate lists built from the same matrix
+     * @param returnToStart Closed tour
+     * @param fixFirst Keep route[0] in place (fixed start)
+     */
+    CandidateLocalSearch(
+        const TspMatrix& matrix,
+        const NeighborLists& neighbors,
+        bool returnToStart,
+        bool fixFirst
+    );
+
+    /**
+     * @brief Improve route until no candidate move helps
+     *
+     * @param route Tour (modified in place)
+     * @param moves Bit mask of Move
+     * @return Cost of the resulting route
+     */
+    double run(std::vector<int>& route, int moves);
+
+    /**
+     * @brief Same, but only the given cities start with their don't-look bit off
+     *
+     * For a route that is already a local optimum except around a few
+     * changed legs (e.g. after a perturbation kick): cost is proportional
+     * to the change instead of to n.
+     */
+    double run(std::vector<int>& route, int moves, const std::vector<int>& activeCities);
+
+    /**
+     * @brief Whether the matrix is symmetric (else OR_3OPT is worth adding)
+     */
+    bool isSymmetric() const {
+        return evaluator_.isSymmetric();
+    }
+
+private:
+    /**
+     * @brief Process the don't-look queue until it is empty
+     */
+    double search(std::vector<int>& route, int moves);
+
+    /**
+     * @brief Try the candidate moves of one city, apply the first improving one
+     */
+    bool improveCity(std::vector<int>& route, int city, int moves);
+
+    bool trySwap(std::vector<int>& route, size_t x, size_t y);
+    bool tryReverse(std::vector<int>& route, size_t i, size_t j);
+    bool tryOrOpt(std::vector<int>& route, size_t i, size_t last, size_t j);
+
+    /**
+     * @brief Reversal-free 3-opt (segment insertion) that joins city and candidate
+     *
+     * Three legs are replaced and no leg changes direction, so the move
+     * suits asymmetric matrices (one-way streets), where 2-opt pays for
+     * reversing its segment. Two of the three new legs come from candidate
+     * lists: candidate -> city (or city -> candidate) and the leg closing
+     * the gap left by the segment, whose other end fixes the segment
+     * length. O(k) tries per candidate, each an O(1) orOptDelta.
+     */
+    bool tryOr3Opt(std::vector<int>& route, int city, int candidate);
+
+    /**
+     * @brief Lin-Kernighan move from city t1 (array tour, 2-opt steps)
+     *
+     * Breaks the leg t1-t2 (t2 = a tour neighbour of t1), then repeatedly
+     * joins the loose end t2 to a candidate t3 and breaks the leg t3-t4,
+     * which is one segment reversal; t4 becomes the new loose end. The
+     * tour is valid after every step, so each gain is exact (also on
+     * asymmetric matrices). The chain continues while the partial gain
+     * stays positive and is rolled back to its best prefix.
+     */
+    bool tryLinKernighan(std::vector<int>& route, int t1);
+
+    /**
+     * @brief Fill steps_ with the valid next chain steps from the loose end of t1
+     */
+    void collectChainSteps(const std::vector<int>& route, int t1, bool forward, double gain);
+
+    /**
+     * @brief Start a new chain: forget which cities were joined
+     */
+    void nextChainStamp();
+
+    /**
+     * @brief Wake up the cities at the given positions (wrapped for closed tours)
+     */
+    void activate(const std::vector<int>& route, std::initializer_list<long> positions);
+
+    /**
+     * @brief Refresh positions and prefix sums after a move
+     */
+    void refresh(const std::vector<int>& route);
+
+    /**
+     * @brief Same, when only positions from..to changed (O(to - from) on symmetric matrices)
+     */
+    void refresh(const std::vector<int>& route, size_t from, size_t to);
+};
@@ -0,0 +1,71 @@
+#include "CheapestInsertion.h"
+#include <algorithm>
+#include <limits>
+
+double cheapestInsertion(std::vector<int>& route, int city, const TspMatrix& matrix, bool returnToStart) {
+    const size_t n = route.size();
+    if (n == 0) {
+        route.push_back(city);
+        return 0.0;
+    }
+    
+    // Distances out of city, read once for every gap
+    const double* fromCity = matrix.getRow(city);
+    
+    size_t bestPos = n;
+    double bestCost = std::numeric_limits<double>::infinity();
+    for (size_t pos = 1; pos < n; pos++) {
+        const double* fromBefore = matrix.getRow(route[pos - 1]);
+        int after = route[pos];
+        double cost = fromBefore[city] + fromCity[after] - fromBefore[after];
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestPos = pos;
+        }
+    }
+    
+    // Gap after the last city: closing leg, or open end
+    const double* fromLast = matrix.getRow(route[n - 1]);
+    double endCost = returnToStart
+        ? fromLast[city] + fromCity[route[0]] - fromLast[route[0]]
+        : fromLast[city];
+    if (endCost < bestCost) {
+        bestCost = endCost;
+        bestPos = n;
+    }
+    
+    route.insert(route.begin() + bestPos, city);
+    return bestCost;
+}
+
+void removeRandomCities(std::vector<int>& route, size_t count, std::mt19937& rng, std::vector<int>& removed) {
+    removed.clear();
+    if (route.size() < 2) {
+        return;
+    }
+    count = std::min(count, route.size() - 1);
+    
+    // Partial Fisher-Yates over positions 1..n-1
+    std::vector<size_t> positions(route.size() - 1);
+    for (size_t i = 0; i < positions.size(); i++) {
+        positions[i] = i + 1;
+    }
+    for (size_t k = 0; k < count; k++) {
+        std::uniform_int_distribution<size_t> dist(k, positions.size() - 1);
+        std::swap(positions[k], positions[dist(rng)]);
+        removed.push_back(route[positions[k]]);
+    }
+    
+    // Compact the route once instead of one erase per city
+    std::vector<char> drop(route.size(), 0);
+    for (size_t k = 0; k < count; k++) {
+        drop[positions[k]] = 1;
+    }
+    size_t write = 0;
+    for (size_t read = 0; read < route.size(); read++) {
+        if (!drop[read]) {
+            route[write++] = route[read];
+        }
+    }
+    route.resize(write);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "TspMatrix.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Insert city into the gap where it adds the least (never before position 0)
+ *
+ * Each gap a -> b is priced in O(1) from the matrix rows as
+ * d(a, city) + d(city, b) - d(a, b); for open routes the gap after the last
+ * city only adds d(last, city).
+ *
+ * @return Cost added to the route
+ */
+double cheapestInsertion(std::vector<int>& route, int city, const TspMatrix& matrix, bool returnToStart);
+
+/**
+ * @brief Remove count random cities (never position 0) in one pass
+ *
+ * @param removed Receives the removed cities, in random order
+ */
+void removeRandomCities(std::vector<int>& route, size_t count, std::mt19937& rng, std::vector<int>& removed);
+
+/**
+ * @brief Destruction size that grows while an Iterated Greedy search stagnates
+ *
+ * Starts at the base size and goes back to it on every improvement; after
+ * STAGNATION_LIMIT rejected iterations one more city is removed, up to
+ * MAX_SIZE (and never more than the route minus its start).
+ */
+class AdaptiveDestruction {
+public:
+    static constexpr int MAX_SIZE = 12;
+    static constexpr int STAGNATION_LIMIT = 50;
+    
+private:
+    int base_;
+    int size_;
+    int stagnant_;
+    
+public:
+    explicit AdaptiveDestruction(int base)
+        : base_(std::max(1, base))
+        , size_(base_)
+        , stagnant_(0)
+    {}
+    
+    /**
+     * @brief Cities to remove from a route of routeSize
+     */
+    size_t size(size_t routeSize) const {
+        return std::min(static_cast<size_t>(size_), routeSize > 1 ? routeSize - 1 : 0);
+    }
+    
+    /**
+     * @brief Record the outcome of one iteration
+     */
+    void update(bool improved) {
+        if (improved) {
+            size_ = base_;
+            stagnant_ = 0;
+        } else if (++stagnant_ >= STAGNATION_LIMIT) {
+            size_ = std::min(size_ + 1, std::max(base_, MAX_SIZE));
+            stagnant_ = 0;
+        }
+    }
+};
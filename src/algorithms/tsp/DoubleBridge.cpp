@@ -0,0 +1,28 @@
+#include "DoubleBridge.h"
+#include <algorithm>
+
+void doubleBridgeKick(std::vector<int>& route, std::mt19937& rng, std::vector<int>& touched) {
+    touched.clear();
+    const size_t n = route.size();
+    if (n < 4) {
+        return;
+    }
+    
+    // Three distinct cut points in [1, n - 1]: A = [0, a), B = [a, b), C = [b, c), D = [c, n)
+    std::uniform_int_distribution<size_t> dist(1, n - 1);
+    size_t cuts[3];
+    do {
+        cuts[0] = dist(rng);
+        cuts[1] = dist(rng);
+        cuts[2] = dist(rng);
+        std::sort(cuts, cuts + 3);
+    } while (cuts[0] == cuts[1] || cuts[1] == cuts[2]);
+    
+    size_t a = cuts[0], b = cuts[1], c = cuts[2];
+    
+    // Ends of the legs A|B, B|C, C|D before the kick
+    touched = {route[a - 1], route[a], route[b - 1], route[b], route[c - 1], route[c]};
+    
+    // A B C D -> A C B D
+    std::rotate(route.begin() + a, route.begin() + b, route.begin() + c);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <random>
+#include <vector>
+
+/**
+ * @brief Double-bridge kick: A B C D -> A C B D (position 0 stays in place)
+ *
+ * Three random cuts; every segment keeps its direction, so the kick is
+ * safe on asymmetric matrices and cannot be undone by a single 2-opt or
+ * Or-opt move. Routes shorter than 4 are left untouched.
+ *
+ * @param route Tour to perturb (modified in place)
+ * @param rng Random generator
+ * @param touched Receives the cities at the ends of the changed legs
+ */
+void doubleBridgeKick(std::vector<int>& route, std::mt19937& rng, std::vector<int>& touched);
@@ -0,0 +1,193 @@
+#include "HeldKarpAlgorithm.h"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+    const double INF = std::numeric_limits<double>::infinity();
+
+    // Masks handed to a worker at a time
+    const size_t MASK_CHUNK = 256;
+
+    inline int popcount(uint32_t mask) {
+        int count = 0;
+        for (; mask; mask &= mask - 1) count++;
+        return count;
+    }
+}
+
+void HeldKarpAlgorithm::relaxMasks(
+    Table& best,
+    const Table& incoming,
+    size_t stride,
+    const std::vector<uint32_t>& masks,
+    size_t begin,
+    size_t end
+) const {
+    for (size_t m = begin; m < end; m++) {
+        uint32_t mask = masks[m];
+        double* row = &best[mask * stride];
+        for (size_t j = 0; j < stride; j++) {
+            if (!(mask & (1u << j))) continue;
+            const double* prevRow = &best[(mask ^ (1u << j)) * stride];
+            const double* toJ = &incoming[j * stride];
+
+            // Entries outside the previous mask are infinity: no membership test
+            double value = INF;
+            for (size_t k = 0; k < stride; k++) {
+                double candidate = prevRow[k] + toJ[k];
+                value = candidate < value ? candidate : value;
+            }
+            row[j] = value;
+        }
+    }
+}
+
+std::vector<int> HeldKarpAlgorithm::solve(
+    const TspMatrix& matrix,
+    const std::vector<int64_t>& /*nodeIds*/
+) {
+    const size_t n = matrix.getSize();
+    if (n > MAX_SIZE) {
+        throw std::invalid_argument("Held-Karp supports at most " + std::to_string(MAX_SIZE) +
+                                    " nodes, got " + std::to_string(n));
+    }
+    const Clock::time_point deadline = beginSolve();
+    
+    if (n <= 2) {
+        std::vector<int> route;
+        for (size_t i = 0; i < n; i++) {
+            route.push_back(static_cast<int>(i));
+        }
+        return route;
+    }
+
+    // Bit k of a mask = city k + 1 (city 0 is the fixed start)
+    const size_t cities = n - 1;
+    const size_t stride = (cities + 3) & ~static_cast<size_t>(3);
+    const uint32_t fullMask = (1u << cities) - 1;
+    const size_t numMasks = static_cast<size_t>(fullMask) + 1;
+
+    // incoming[j][k] = d(k + 1, j + 1): column j of the matrix, contiguous
+    Table incoming(cities * stride, INF);
+    for (size_t j = 0; j < cities; j++) {
+        for (size_t k = 0; k < cities; k++) {
+            if (k != j) {
+                incoming[j * stride + k] = matrix.getDistance(k + 1, j + 1);
+            }
+        }
+    }
+
+    Table best(numMasks * stride, INF);
+    for (size_t j = 0; j < cities; j++) {
+        best[(size_t(1) << j) * stride + j] = matrix.getDistance(0, j + 1);
+    }
+
+    // Masks grouped by size (counting sort on popcount)
+    std::vector<size_t> layerStart(cities + 2, 0);
+    for (uint32_t mask = 0; mask <= fullMask; mask++) {
+        layerStart[popcount(mask) + 1]++;
+    }
+    for (size_t s = 1; s < layerStart.size(); s++) {
+        layerStart[s] += layerStart[s - 1];
+    }
+    std::vector<uint32_t> masks(numMasks);
+    {
+        std::vector<size_t> fill(layerStart.begin(), layerStart.end() - 1);
+        for (uint32_t mask = 0; mask <= fullMask; mask++) {
+            masks[fill[popcount(mask)]++] = mask;
+        }
+    }
+
+    unsigned int numThreads = numThreads_ > 0
+        ? static_cast<unsigned int>(numThreads_)
+        : std::thread::hardware_concurrency();
+    if (numThreads == 0 || n < PARALLEL_MIN_SIZE) {
+        numThreads = 1;
+    }
+
+    for (size_t layer = 2; layer <= cities; layer++) {
+        if (timeUp(deadline)) {
+            // No partial answer: hand back the starting tour
+            std::cout << "[Held-Karp] Time limit reached at layer " << layer << "/" << cities << std::endl;
+            return startingTour(matrix, returnToStart_);
+        }
+        
+        size_t begin = layerStart[layer];
+        size_t end = layerStart[layer + 1];
+        size_t workers = std::min<size_t>(numThreads, (end - begin + MASK_CHUNK - 1) / MASK_CHUNK);
+
+        if (workers <= 1) {
+            relaxMasks(best, incoming, stride, masks, begin, end);
+            continue;
+        }
+
+        std::atomic<size_t> next{begin};
+        auto worker = [&]() {
+            while (true) {
+                size_t from = next.fetch_add(MASK_CHUNK);
+                if (from >= end) break;
+                relaxMasks(best, incoming, stride, masks, from, std::min(from + MASK_CHUNK, end));
+            }
+        };
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < workers; t++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    // Best last city (plus the closing leg for closed tours)
+    const double* fullRow = &best[fullMask * stride];
+    uint32_t last = 0;
+    double bestDist = INF;
+    for (uint32_t j = 0; j < cities; j++) {
+        double dist = fullRow[j] + (returnToStart_ ? matrix.getDistance(j + 1, 0) : 0.0);
+        if (dist < bestDist) {
+            bestDist = dist;
+            last = j;
+        }
+    }
+
+    if (bestDist == INF) {
+        // No finite path through every city (validated upstream); any permutation will do
+        return matrix.nearestNeighborRoute(0);
+    }
+
+    // Walk back: the predecessor is the argmin that produced each entry
+    std::vector<int> route(n);
+    route[0] = 0;
+    uint32_t mask = fullMask;
+    for (size_t pos = n - 1; pos > 0; pos--) {
+        route[pos] = static_cast<int>(last + 1);
+        uint32_t prevMask = mask ^ (1u << last);
+        if (prevMask == 0) break;
+
+        const double* prevRow = &best[prevMask * stride];
+        const double* toLast = &incoming[last * stride];
+        uint32_t prev = 0;
+        double value = INF;
+        for (uint32_t k = 0; k < cities; k++) {
+            if (prevRow[k] + toLast[k] < value) {
+                value = prevRow[k] + toLast[k];
+                prev = k;
+            }
+        }
+        mask = prevMask;
+        last = prev;
+    }
+
+    reportImprovement(route, bestDist);
+    
+    std::cout << "[Held-Karp] Optimal route distance: " << bestDist << std::endl;
+    std::cout << "[Held-Karp] Route size: " << route.size() << " nodes" << std::endl;
+
+    return route;
+}
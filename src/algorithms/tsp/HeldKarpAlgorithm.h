@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../../core/interfaces/ITspAlgorithm.h"
+#include "TspMatrix.h"
+#include "../../utils/AlignedAllocator.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Exact TSP by Held-Karp dynamic programming
+ *
+ * - Index 0 is the fixed start; the other n-1 cities are bits of a mask
+ * - best[mask][j] = cheapest path from 0 through exactly the cities of
+ *   mask, ending at j. Masks are processed by layers of equal size; every
+ *   mask of a layer only reads the previous one, so a layer is split
+ *   among worker threads
+ * - The table is one contiguous aligned buffer (row per mask, padded).
+ *   Cities outside a mask hold infinity, so each entry is a branch-free
+ *   min over (row of the mask without j) + (column j of the matrix),
+ *   two contiguous arrays the compiler vectorises
+ * - O(2^n · n²) time, O(2^n · n) memory: only for small instances
+ *   (MAX_SIZE), where it returns the optimal open path or closed tour
+ * - Deterministic (no seed); the time limit is checked between layers and,
+ *   if reached, the initial tour (or the configured construction) is returned
+ */
+class HeldKarpAlgorithm : public ITspAlgorithm {
+private:
+    bool returnToStart_;
+    int numThreads_;            // 0 = std::thread::hardware_concurrency()
+
+    using Table = std::vector<double, AlignedAllocator<double>>;
+
+public:
+    /**
+     * @brief Largest instance accepted (table of 2^19 rows, ~84 MB)
+     */
+    static constexpr size_t MAX_SIZE = 20;
+
+    /**
+     * @brief Largest instance TspService solves exactly instead of with the chosen heuristic
+     */
+    static constexpr size_t AUTO_SELECT_MAX_SIZE = 18;
+
+    /**
+     * @brief Layers are split among threads from this many cities on (smaller ones take < 1 ms)
+     */
+    static constexpr size_t PARALLEL_MIN_SIZE = 14;
+
+    explicit HeldKarpAlgorithm(bool returnToStart = false, int numThreads = 0)
+        : returnToStart_(returnToStart)
+        , numThreads_(numThreads)
+    {}
+
+    /**
+     * @throws std::invalid_argument if the matrix has more than MAX_SIZE cities
+     */
+    std::vector<int> solve(
+        const TspMatrix& matrix,
+        const std::vector<int64_t>& nodeIds
+    ) override;
+
+    std::string getName() const override {
+        return "Held-Karp";
+    }
+
+    void setReturnToStart(bool value) override {
+        returnToStart_ = value;
+    }
+
+    void setNumThreads(int numThreads) {
+        numThreads_ = numThreads;
+    }
+
+private:
+    /**
+     * @brief best[mask][j] for every mask of one layer (positions [begin, end) of masks)
+     */
+    void relaxMasks(
+        Table& best,
+        const Table& incoming,
+        size_t stride,
+        const std::vector<uint32_t>& masks,
+        size_t begin,
+        size_t end
+    ) const;
+};
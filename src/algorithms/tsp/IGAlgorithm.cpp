@@ -1,4 +1,6 @@
 #include "IGAlgorithm.h"
+#include "CandidateLocalSearch.h"
+#include "CheapestInsertion.h"
 #include <iostream>
 #include <algorithm>
 
@@ -6,34 +8,44 @@ std::vector<int> IGAlgorithm::solve(
     const TspMatrix& matrix,
     const std::vector<int64_t>& nodeIds
 ) {
-    // Heuristic initialization: Nearest Neighbor
-    std::vector<int> initialRoute = matrix.nearestNeighborRoute(0);
+    const Clock::time_point deadline = beginSolve();
+    
+    // Heuristic initialization: caller-provided tour, else the configured construction
+    std::vector<int> initialRoute = startingTour(matrix, returnToStart_);
     
     std::vector<int> best = initialRoute;
     double bestDist = routeDistance(best, matrix);
     
+    // Candidate lists and search buffers shared by every local search of this solve
+    // (position 0 stays fixed, as the start node)
+    NeighborLists neighbors(matrix);
+    CandidateLocalSearch search(matrix, neighbors, returnToStart_, true);
+    
     std::vector<int> current = best;
-    bestDist = localSearch(current, matrix);
+    bestDist = localSearch(current, search);
     best = current;
+    reportImprovement(best, bestDist);
     
-    std::random_device rd;
-    std::mt19937 rng(rd());
+    std::mt19937 rng = makeRng();
+    AdaptiveDestruction destruction(destructionSize_);
     
-    // Iterated Greedy: 5000 iterations by default
-    for (int iter = 0; iter < maxIterations_; iter++) {
+    // Iterated Greedy: 5000 iterations by default (or until the time limit / target gap)
+    for (int iter = 0; iter < maxIterations_ && !timeUp(deadline) && !gapReached(bestDist); iter++) {
         std::vector<int> temp = current;
         
         // Destruction + Construction
-        removeAndReinsert(temp, rng);
+        removeAndReinsert(temp, matrix, destruction.size(temp.size()), rng);
         
         // Local Search
-        double dist = localSearch(temp, matrix);
+        double dist = localSearch(temp, search);
         
         // Aceptation
+        destruction.update(dist < bestDist);
         if (dist < bestDist) {
             bestDist = dist;
             best = temp;
             current = temp;
+            reportImprovement(best, bestDist);
         } else {
             current = best; // Reset to best solution
         }
@@ -50,55 +62,24 @@ std::vector<int> IGAlgorithm::solve(
     return best;
 }
 
-void IGAlgorithm::removeAndReinsert(std::vector<int>& route, std::mt19937& rng) {
+void IGAlgorithm::removeAndReinsert(std::vector<int>& route, const TspMatrix& matrix, size_t count, std::mt19937& rng) {
     if (route.size() < 4) {
         return; // Not enough nodes to destroy
     }
     
-    int n = std::min(3, static_cast<int>(route.size()));
+    // Destruction: remove count random nodes
     std::vector<int> removed;
+    removeRandomCities(route, count, rng, removed);
     
-    // Destruction: Remove n random nodes
-    for (int k = 0; k < n; k++) {
-        std::uniform_int_distribution<int> dist(0, route.size() - 1);
-        int idx = dist(rng);
-        removed.push_back(route[idx]);
-        route.erase(route.begin() + idx);
-    }
-    
-    // Construction: Reinsert nodes at random positions
+    // Construction: each node where it adds the least
     for (int node : removed) {
-        std::uniform_int_distribution<int> dist(0, route.size());
-        int idx = dist(rng);
-        route.insert(route.begin() + idx, node);
+        cheapestInsertion(route, node, matrix, returnToStart_);
     }
 }
 
-double IGAlgorithm::localSearch(std::vector<int>& route, const TspMatrix& matrix) {
-    bool improved = true;
-    double bestDist = routeDistance(route, matrix);
-    
-    while (improved) {
-        improved = false;
-        
-        // 2-opt swap
-        for (size_t i = 0; i < route.size(); i++) {
-            for (size_t j = i + 1; j < route.size(); j++) {
-                std::swap(route[i], route[j]);
-                
-                double dist = routeDistance(route, matrix);
-                
-                if (dist < bestDist) {
-                    bestDist = dist;
-                    improved = true;
-                } else {
-                    std::swap(route[i], route[j]); // Revert
-                }
-            }
-        }
-    }
-    
-    return bestDist;
+double IGAlgorithm::localSearch(std::vector<int>& route, CandidateLocalSearch& search) {
+    // Swaps that put a city next to one of its nearest neighbours
+    return search.run(route, CandidateLocalSearch::SWAP);
 }
 
 double IGAlgorithm::routeDistance(const std::vector<int>& route, const TspMatrix& matrix) const {
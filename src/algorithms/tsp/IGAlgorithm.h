@@ -2,24 +2,33 @@
 
 #include "../../core/interfaces/ITspAlgorithm.h"
 #include "TspMatrix.h"
+#include "CandidateLocalSearch.h"
 #include <random>
 
 /**
  * @brief Iterated Greedy for TSP
  * 
- * - removeAndReinsert() → destruction + construction
- * - localSearch() → 2-opt swap
+ * - removeAndReinsert() → destruction (random cities, adaptive count) +
+ *   construction (cheapest insertion, O(1) per gap)
+ * - localSearch() → swap moves over neighbour lists (don't-look bits)
  * - 5000 iterations by default
  */
 class IGAlgorithm : public ITspAlgorithm {
 private:
     int maxIterations_;
     bool returnToStart_;
+    int destructionSize_;
     
 public:
+    /**
+     * @brief Cities removed per destruction (grows while the search stagnates)
+     */
+    static constexpr int DEFAULT_DESTRUCTION_SIZE = 4;
+    
     IGAlgorithm(int maxIterations = 5000, bool returnToStart = false)
         : maxIterations_(maxIterations)
         , returnToStart_(returnToStart)
+        , destructionSize_(DEFAULT_DESTRUCTION_SIZE)
     {}
     
     std::vector<int> solve(
@@ -31,7 +40,7 @@ public:
         return "IG";
     }
     
-    void setReturnToStart(bool value) {
+    void setReturnToStart(bool value) override {
         returnToStart_ = value;
     }
     
@@ -39,16 +48,20 @@ public:
         maxIterations_ = maxIterations;
     }
     
+    void setDestructionSize(int destructionSize) {
+        destructionSize_ = destructionSize;
+    }
+    
 private:
     /**
-     * @brief Destruction + Construction
+     * @brief Destruction + Construction (position 0 stays in place)
      */
-    void removeAndReinsert(std::vector<int>& route, std::mt19937& rng);
+    void removeAndReinsert(std::vector<int>& route, const TspMatrix& matrix, size_t count, std::mt19937& rng);
     
     /**
-     * @brief Local Search (2-opt swap)
+     * @brief Local Search (swap moves restricted to candidate neighbours)
      */
-    double localSearch(std::vector<int>& route, const TspMatrix& matrix);
+    double localSearch(std::vector<int>& route, CandidateLocalSearch& search);
     
     /**
      * @brief Calculate route distance
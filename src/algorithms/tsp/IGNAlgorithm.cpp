@@ -1,27 +1,19 @@
 #include "IGNAlgorithm.h"
+#include "CheapestInsertion.h"
 #include <algorithm>
 #include <iostream>
 #include <limits>
 
-void IGNAlgorithm::removeAndReinsert(std::vector<int>& route, std::mt19937& rng) {
+void IGNAlgorithm::removeAndReinsert(std::vector<int>& route, const TspMatrix& matrix, size_t count, std::mt19937& rng) {
     if (route.size() < 3) return;
     
-    int n = std::min(3, static_cast<int>(route.size()));
+    // Remove count random nodes (the start stays first)
     std::vector<int> removed;
+    removeRandomCities(route, count, rng, removed);
     
-    // Remove n random nodes
-    for (int k = 0; k < n; k++) {
-        std::uniform_int_distribution<int> dist(0, route.size() - 1);
-        int idx = dist(rng);
-        removed.push_back(route[idx]);
-        route.erase(route.begin() + idx);
-    }
-    
-    // Reinsert at random positions
+    // Reinsert each where it adds the least
     for (int node : removed) {
-        std::uniform_int_distribution<int> dist(0, route.size());
-        int idx = dist(rng);
-        route.insert(route.begin() + idx, node);
+        cheapestInsertion(route, node, matrix, returnToStart_);
     }
 }
 
@@ -47,30 +39,35 @@ std::vector<int> IGNAlgorithm::solve(
         return {};
     }
     
-    // Get initial solution using Nearest Neighbor
-    std::vector<int> currentRoute = matrix.nearestNeighborRoute(0);  // Start from index 0
+    const Clock::time_point deadline = beginSolve();
+    
+    // Initial solution: caller-provided tour, else the configured construction
+    std::vector<int> currentRoute = startingTour(matrix, returnToStart_);
     std::vector<int> bestRoute = currentRoute;
     double bestDist = routeDistance(bestRoute, matrix);
     
-    std::random_device rd;
-    std::mt19937 rng(rd());
+    std::mt19937 rng = makeRng();
+    AdaptiveDestruction destruction(destructionSize_);
     
     std::cout << "[IGN] Initial distance: " << bestDist << std::endl;
+    reportImprovement(bestRoute, bestDist);
     
     // Iterated Greedy iterations
-    for (int iter = 0; iter < maxIterations_; iter++) {
+    for (int iter = 0; iter < maxIterations_ && !timeUp(deadline) && !gapReached(bestDist); iter++) {
         std::vector<int> tempRoute = currentRoute;
         
         // Destruction + Construction
-        removeAndReinsert(tempRoute, rng);
+        removeAndReinsert(tempRoute, matrix, destruction.size(tempRoute.size()), rng);
         
         double dist = routeDistance(tempRoute, matrix);
         
         // Accept if better
+        destruction.update(dist < bestDist);
         if (dist < bestDist) {
             bestDist = dist;
             bestRoute = tempRoute;
             currentRoute = tempRoute;
+            reportImprovement(bestRoute, bestDist);
         } else {
             // Reset to best (greedy acceptance)
             currentRoute = bestRoute;
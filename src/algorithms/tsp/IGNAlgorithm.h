@@ -5,10 +5,12 @@
 #include <random>
 
 /**
- * @brief Iterated Greedy with Nearest Neighbor for TSP
+ * @brief Iterated Greedy without local search for TSP
  * 
- * Similar to IG but uses Nearest Neighbor for initial solution
- * - removeAndReinsert() → destruction + construction (3 nodes)
+ * Similar to IG; the starting tour comes from setInitialTour() or
+ * setConstruction() (Nearest Neighbor by default)
+ * - removeAndReinsert() → destruction (random cities, adaptive count) +
+ *   construction (cheapest insertion, O(1) per gap)
  * - No local search (faster than IG)
  * - 10000 iterations by default
  */
@@ -16,11 +18,18 @@ class IGNAlgorithm : public ITspAlgorithm {
 private:
     int maxIterations_;
     bool returnToStart_;
+    int destructionSize_;
     
 public:
+    /**
+     * @brief Cities removed per destruction (grows while the search stagnates)
+     */
+    static constexpr int DEFAULT_DESTRUCTION_SIZE = 4;
+    
     IGNAlgorithm(int maxIterations = 10000, bool returnToStart = false)
         : maxIterations_(maxIterations)
         , returnToStart_(returnToStart)
+        , destructionSize_(DEFAULT_DESTRUCTION_SIZE)
     {}
     
     std::vector<int> solve(
@@ -32,7 +41,7 @@ public:
         return "IGN";
     }
     
-    void setReturnToStart(bool value) {
+    void setReturnToStart(bool value) override {
         returnToStart_ = value;
     }
     
@@ -40,11 +49,15 @@ public:
         maxIterations_ = maxIterations;
     }
     
+    void setDestructionSize(int destructionSize) {
+        destructionSize_ = destructionSize;
+    }
+    
 private:
     /**
-     * @brief Remove and reinsert 3 random nodes
+     * @brief Remove count random nodes and reinsert each at its cheapest gap
      */
-    void removeAndReinsert(std::vector<int>& route, std::mt19937& rng);
+    void removeAndReinsert(std::vector<int>& route, const TspMatrix& matrix, size_t count, std::mt19937& rng);
     
     /**
      * @brief Calculate total route distance
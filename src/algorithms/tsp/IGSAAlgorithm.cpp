@@ -0,0 +1,178 @@
+#include "IGSAAlgorithm.h"
+#include "CheapestInsertion.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace {
+    const int LOCAL_SEARCH_MOVES = CandidateLocalSearch::TWO_OPT | CandidateLocalSearch::OR_OPT;
+}
+
+void IGSAAlgorithm::destroyAndRebuild(
+    std::vector<int>& route,
+    const TspMatrix& matrix,
+    const NeighborLists& neighbors,
+    std::mt19937& rng,
+    std::vector<int>& touched
+) const {
+    touched.clear();
+    if (route.size() < 4) {
+        return;
+    }
+    
+    int count = std::min(DESTRUCTION_SIZE, static_cast<int>(route.size()) - 2);
+    
+    // Destruction: a random city and its nearest neighbours, so the rebuild
+    // can reorder one neighbourhood (never the start at position 0)
+    std::uniform_int_distribution<size_t> dist(1, route.size() - 1);
+    int seed = route[dist(rng)];
+    std::vector<int> removed = {seed};
+    const int* candidates = neighbors.get(seed);
+    for (size_t r = 0; r < neighbors.getK() && static_cast<int>(removed.size()) < count; r++) {
+        if (candidates[r] != route[0]) removed.push_back(candidates[r]);
+    }
+    
+    for (int city : removed) {
+        size_t idx = std::find(route.begin(), route.end(), city) - route.begin();
+        touched.push_back(route[idx - 1]);
+        if (idx + 1 < route.size()) touched.push_back(route[idx + 1]);
+        route.erase(route.begin() + idx);
+    }
+    
+    // Construction: each city (in random order) at the position where it adds the least
+    std::shuffle(removed.begin(), removed.end(), rng);
+    for (int city : removed) {
+        cheapestInsertion(route, city, matrix, returnToStart_);
+        touched.push_back(city);
+    }
+}
+
+double IGSAAlgorithm::routeDistance(const std::vector<int>& route, const TspMatrix& matrix) const {
+    return matrix.calculateTourCost(route, returnToStart_);
+}
+
+std::vector<int> IGSAAlgorithm::solve(
+    const TspMatrix& matrix,
+    const std::vector<int64_t>& nodeIds
+) {
+    if (nodeIds.empty()) {
+        return {};
+    }
+    
+    const Clock::time_point deadline = beginSolve();
+    
+    // Shared, read-only for every chain
+    NeighborLists neighbors(matrix);
+    std::vector<int> initialRoute = startingTour(matrix, returnToStart_);
+    int moves = LOCAL_SEARCH_MOVES;
+    {
+        // Asymmetric matrix (one-way streets): add moves that keep every leg's direction
+        CandidateLocalSearch search(matrix, neighbors, returnToStart_, true);
+        moves = search.isSymmetric() ? LOCAL_SEARCH_MOVES : LOCAL_SEARCH_MOVES | CandidateLocalSearch::OR_3OPT;
+        search.run(initialRoute, moves);
+    }
+    
+    // Global best, exchanged between chains
+    std::mutex bestMutex;
+    const double initialDist = routeDistance(initialRoute, matrix);
+    std::vector<int> globalBest = initialRoute;
+    double globalBestDist = initialDist;
+    
+    std::cout << "[IGSA] Initial distance after local search: " << initialDist << std::endl;
+    reportImprovement(globalBest, globalBestDist);
+    
+    // Temperatures relative to the average leg, so they do not depend on the units
+    size_t legs = returnToStart_ ? initialRoute.size() : initialRoute.size() - 1;
+    double averageLeg = legs > 0 ? initialDist / legs : 0.0;
+    double startTemperature = START_TEMPERATURE * averageLeg;
+    double logCooling = std::log(END_TEMPERATURE / START_TEMPERATURE);
+    
+    unsigned int numThreads = numThreads_ > 0
+        ? static_cast<unsigned int>(numThreads_)
+        : std::max(1u, std::thread::hardware_concurrency());
+    
+    unsigned int seedBase = makeRng()();
+    
+    // Set by the first chain whose best is within the target gap: all stop
+    std::atomic<bool> gapDone{gapReached(initialDist)};
+    
+    auto chain = [&](unsigned int chainIndex) {
+        std::mt19937 rng(seedBase + chainIndex);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        CandidateLocalSearch search(matrix, neighbors, returnToStart_, true);
+        
+        std::vector<int> current = initialRoute;
+        double currentDist = initialDist;
+        std::vector<int> best = current;
+        double bestDist = currentDist;
+        std::vector<int> candidate;
+        std::vector<int> touched;
+        
+        for (int iter = 0; iter < maxIterations_ && !gapDone.load(std::memory_order_relaxed); iter++) {
+            // Geometric cooling over the iterations, or over the time limit
+            // if that runs out first (a cut run still ends cold)
+            double progress = maxIterations_ > 1 ? static_cast<double>(iter) / (maxIterations_ - 1) : 1.0;
+            if (deadline != Clock::time_point::max()) {
+                Clock::time_point now = Clock::now();
+                if (now >= deadline) break;
+                double left = std::chrono::duration<double>(deadline - now).count() / timeLimitSeconds_;
+                progress = std::max(progress, 1.0 - left);
+            }
+            double temperature = startTemperature * std::exp(logCooling * progress);
+            
+            candidate = current;
+            destroyAndRebuild(candidate, matrix, neighbors, rng, touched);
+            double dist = search.run(candidate, moves, touched);
+            
+            // Simulated annealing acceptance
+            double delta = dist - currentDist;
+            if (delta <= 0.0 || (temperature > 0.0 && uniform(rng) < std::exp(-delta / temperature))) {
+                current.swap(candidate);
+                currentDist = dist;
+                if (currentDist < bestDist) {
+                    best = current;
+                    bestDist = currentDist;
+                    if (gapReached(bestDist)) {
+                        gapDone.store(true, std::memory_order_relaxed);
+                    }
+                }
+            }
+            // Exchange: publish our best, continue from the global best if it is better
+            if ((iter + 1) % EXCHANGE_INTERVAL == 0) {
+                std::lock_guard<std::mutex> lock(bestMutex);
+                if (bestDist < globalBestDist) {
+                    globalBestDist = bestDist;
+                    globalBest = best;
+                    reportImprovement(globalBest, globalBestDist);
+                } else if (globalBestDist < currentDist) {
+                    current = globalBest;
+                    currentDist = globalBestDist;
+                }
+            }
+        }
+        
+        // Final publish (also when the time limit cut the chain short)
+        std::lock_guard<std::mutex> lock(bestMutex);
+        if (bestDist < globalBestDist) {
+            globalBestDist = bestDist;
+            globalBest = best;
+            reportImprovement(globalBest, globalBestDist);
+        }
+    };
+    
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < numThreads; t++) {
+        threads.emplace_back(chain, t);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    std::cout << "[IGSA] " << numThreads << " chains x " << maxIterations_ << " iterations" << std::endl;
+    std::cout << "[IGSA] Optimal distance: " << globalBestDist << " m" << std::endl;
+    
+    return globalBest;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "../../core/interfaces/ITspAlgorithm.h"
+#include "TspMatrix.h"
+#include "CandidateLocalSearch.h"
+#include <random>
+
+/**
+ * @brief Multi-threaded Iterated Greedy with Simulated Annealing acceptance
+ * 
+ * - One annealing chain per thread (all cores by default), each with its
+ *   own RNG and search buffers; the TspMatrix and neighbour lists are
+ *   shared read-only
+ * - Iteration: remove a random city and its nearest neighbours, reinsert
+ *   each at its cheapest position, repair with candidate 2-opt / Or-opt
+ *   around the change
+ * - Acceptance: always if better, otherwise with probability
+ *   exp(-delta / T); T cools geometrically over the iterations, or over
+ *   the time limit if that is reached first
+ * - Every EXCHANGE_INTERVAL iterations a chain publishes its best tour
+ *   and restarts from the global best if that is better
+ * - 5000 iterations per chain by default
+ * 
+ * With an explicit seed each chain is seeded from it, but exchanges
+ * depend on thread timing: only a single chain is fully reproducible.
+ */
+class IGSAAlgorithm : public ITspAlgorithm {
+private:
+    int maxIterations_;
+    bool returnToStart_;
+    int numThreads_;            // 0 = std::thread::hardware_concurrency()
+    
+public:
+    /**
+     * @brief Iterations between best-solution exchanges
+     */
+    static constexpr int EXCHANGE_INTERVAL = 200;
+    
+    /**
+     * @brief Cities removed per destruction
+     */
+    static constexpr int DESTRUCTION_SIZE = 6;
+    
+    /**
+     * @brief Start / end temperature as a fraction of the average leg length
+     */
+    static constexpr double START_TEMPERATURE = 0.1;
+    static constexpr double END_TEMPERATURE = 0.001;
+    
+    IGSAAlgorithm(int maxIterations = 5000, bool returnToStart = false, int numThreads = 0)
+        : maxIterations_(maxIterations)
+        , returnToStart_(returnToStart)
+        , numThreads_(numThreads)
+    {}
+    
+    std::vector<int> solve(
+        const TspMatrix& matrix,
+        const std::vector<int64_t>& nodeIds
+    ) override;
+    
+    std::string getName() const override {
+        return "IGSA";
+    }
+    
+    void setReturnToStart(bool value) override {
+        returnToStart_ = value;
+    }
+    
+    void setMaxIterations(int maxIterations) override {
+        maxIterations_ = maxIterations;
+    }
+    
+    void setNumThreads(int numThreads) {
+        numThreads_ = numThreads;
+    }
+    
+private:
+    /**
+     * @brief Destruction + greedy reconstruction (position 0 stays in place)
+     * 
+     * @param touched Receives the reinserted cities and the ends of the closed gaps
+     */
+    void destroyAndRebuild(
+        std::vector<int>& route,
+        const TspMatrix& matrix,
+        const NeighborLists& neighbors,
+        std::mt19937& rng,
+        std::vector<int>& touched
+    ) const;
+    
+    /**
+     * @brief Calculate route distance
+     */
+    double routeDistance(const std::vector<int>& route, const TspMatrix& matrix) const;
+};
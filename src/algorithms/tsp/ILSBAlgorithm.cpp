@@ -1,35 +1,17 @@
 #include "ILSBAlgorithm.h"
+#include "CandidateLocalSearch.h"
 #include <algorithm>
 #include <iostream>
 #include <limits>
 
-double ILSBAlgorithm::localSearch(std::vector<int>& route, const TspMatrix& matrix) {
-    bool improved = true;
-    double bestDist = routeDistance(route, matrix);
-    
-    while (improved) {
-        improved = false;
-        
-        // Try all 2-opt moves (reverse segments, not simple swaps)
-        for (size_t i = 0; i < route.size() - 1; i++) {
-            for (size_t j = i + 2; j < route.size(); j++) {
-                // Reverse segment [i+1, j]
-                std::reverse(route.begin() + i + 1, route.begin() + j + 1);
-                
-                double dist = routeDistance(route, matrix);
-                
-                if (dist < bestDist) {
-                    bestDist = dist;
-                    improved = true;
-                } else {
-                    // Revert: reverse again to undo
-                    std::reverse(route.begin() + i + 1, route.begin() + j + 1);
-                }
-            }
-        }
+double ILSBAlgorithm::localSearch(std::vector<int>& route, CandidateLocalSearch& search) {
+    // 2-opt reversals and Or-opt segment moves towards the nearest neighbours,
+    // plus reversal-free 3-opt when one-way streets make the matrix asymmetric
+    int moves = CandidateLocalSearch::TWO_OPT | CandidateLocalSearch::OR_OPT;
+    if (!search.isSymmetric()) {
+        moves |= CandidateLocalSearch::OR_3OPT;
     }
-    
-    return bestDist;
+    return search.run(route, moves);
 }
 
 double ILSBAlgorithm::routeDistance(const std::vector<int>& route, const TspMatrix& matrix) const {
@@ -54,32 +36,40 @@ std::vector<int> ILSBAlgorithm::solve(
         return {};
     }
     
-    // Get initial solution using Nearest Neighbor
-    std::vector<int> currentRoute = matrix.nearestNeighborRoute(0);  // Start from index 0
+    const Clock::time_point deadline = beginSolve();
+    
+    // Initial solution: caller-provided tour, else the configured construction
+    std::vector<int> currentRoute = startingTour(matrix, returnToStart_);
     std::vector<int> bestRoute = currentRoute;
     
+    // Candidate lists and search buffers shared by every local search of this solve
+    // (position 0 stays fixed, as the start node)
+    NeighborLists neighbors(matrix);
+    CandidateLocalSearch search(matrix, neighbors, returnToStart_, true);
+    
     // Apply initial local search
-    double bestDist = localSearch(currentRoute, matrix);
+    double bestDist = localSearch(currentRoute, search);
     bestRoute = currentRoute;
     
-    std::random_device rd;
-    std::mt19937 rng(rd());
+    std::mt19937 rng = makeRng();
     
     std::cout << "[ILSB] Initial distance after local search: " << bestDist << std::endl;
+    reportImprovement(bestRoute, bestDist);
     
     // Iterated Local Search iterations
-    for (int iter = 0; iter < maxIterations_; iter++) {
-        // Perturbation: shuffle a copy of best route
+    for (int iter = 0; iter < maxIterations_ && !timeUp(deadline) && !gapReached(bestDist); iter++) {
+        // Perturbation: shuffle a copy of best route, start node excluded
         currentRoute = bestRoute;
-        std::shuffle(currentRoute.begin(), currentRoute.end(), rng);
+        std::shuffle(currentRoute.begin() + 1, currentRoute.end(), rng);
         
         // Local search
-        double dist = localSearch(currentRoute, matrix);
+        double dist = localSearch(currentRoute, search);
         
         // Accept if better
         if (dist < bestDist) {
             bestDist = dist;
             bestRoute = currentRoute;
+            reportImprovement(bestRoute, bestDist);
         }
     }
     
@@ -2,13 +2,14 @@
 
 #include "../../core/interfaces/ITspAlgorithm.h"
 #include "TspMatrix.h"
+#include "CandidateLocalSearch.h"
 #include <random>
 
 /**
  * @brief Iterated Local Search Basic for TSP
  * 
  * - Uses shuffle for perturbation
- * - Local search with 2-opt swaps
+ * - Local search with 2-opt and Or-opt over neighbour lists (don't-look bits)
  * - 5000 iterations by default
  * - Simpler than IG, faster convergence
  */
@@ -32,7 +33,7 @@ public:
         return "ILSB";
     }
     
-    void setReturnToStart(bool value) {
+    void setReturnToStart(bool value) override {
         returnToStart_ = value;
     }
     
@@ -42,10 +43,10 @@ public:
     
 private:
     /**
-     * @brief Local search using 2-opt swaps
+     * @brief Local search using 2-opt and Or-opt candidate moves
      * Returns the best distance found
      */
-    double localSearch(std::vector<int>& route, const TspMatrix& matrix);
+    double localSearch(std::vector<int>& route, CandidateLocalSearch& search);
     
     /**
      * @brief Calculate total route distance
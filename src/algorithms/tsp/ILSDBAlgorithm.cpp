@@ -0,0 +1,61 @@
+#include "ILSDBAlgorithm.h"
+#include "DoubleBridge.h"
+#include <algorithm>
+#include <iostream>
+
+double ILSDBAlgorithm::routeDistance(const std::vector<int>& route, const TspMatrix& matrix) const {
+    return matrix.calculateTourCost(route, returnToStart_);
+}
+
+std::vector<int> ILSDBAlgorithm::solve(
+    const TspMatrix& matrix,
+    const std::vector<int64_t>& nodeIds
+) {
+    if (nodeIds.empty()) {
+        return {};
+    }
+    
+    const Clock::time_point deadline = beginSolve();
+    
+    // Caller-provided tour, else the configured construction (index 0 stays the start node)
+    std::vector<int> bestRoute = startingTour(matrix, returnToStart_);
+    
+    NeighborLists neighbors(matrix);
+    CandidateLocalSearch search(matrix, neighbors, returnToStart_, true);
+    
+    // Asymmetric matrix (one-way streets): add moves that keep every leg's direction
+    const int moves = search.isSymmetric() ? localSearchMoves_ : localSearchMoves_ | CandidateLocalSearch::OR_3OPT;
+    
+    double bestDist = search.run(bestRoute, moves);
+    std::cout << "[" << getName() << "] Initial distance after local search: " << bestDist << std::endl;
+    reportImprovement(bestRoute, bestDist);
+    
+    std::mt19937 rng = makeRng();
+    
+    std::vector<int> currentRoute;
+    std::vector<int> touched;
+    
+    for (int iter = 0; iter < maxIterations_ && !timeUp(deadline) && !gapReached(bestDist); iter++) {
+        currentRoute = bestRoute;
+        doubleBridgeKick(currentRoute, rng, touched);
+        
+        // The rest of the tour is still a local optimum: only look around the kick
+        double dist = search.run(currentRoute, moves, touched);
+        
+        // Accept sideways moves too, to drift across plateaus
+        if (dist <= bestDist) {
+            bool improved = dist < bestDist;
+            bestDist = dist;
+            bestRoute.swap(currentRoute);
+            if (improved) {
+                reportImprovement(bestRoute, bestDist);
+            }
+        }
+    }
+    
+    double finalDist = routeDistance(bestRoute, matrix);
+    std::cout << "[" << getName() << "] Optimal route distance: " << finalDist << std::endl;
+    std::cout << "[" << getName() << "] Route size: " << bestRoute.size() << " nodes" << std::endl;
+    
+    return bestRoute;
+}
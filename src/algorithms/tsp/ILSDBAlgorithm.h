@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../../core/interfaces/ITspAlgorithm.h"
+#include "TspMatrix.h"
+#include "CandidateLocalSearch.h"
+#include <random>
+
+/**
+ * @brief Iterated Local Search with double-bridge kicks for TSP
+ * 
+ * - Perturbation: double-bridge (A B C D -> A C B D), keeps every segment
+ *   intact and never reverses one, so it is safe on asymmetric matrices
+ * - Local search: Or-opt (segments of 1-3 cities) and 2-opt over
+ *   neighbour lists, restarted only around the 3 reconnected legs
+ * - Acceptance: keep the kicked tour if it is not worse than the best
+ * - 5000 iterations by default
+ * 
+ * Unlike ILSB (which reshuffles the whole route), each iteration starts
+ * from a local optimum and only repairs the kick.
+ */
+class ILSDBAlgorithm : public ITspAlgorithm {
+private:
+    int maxIterations_;
+    bool returnToStart_;
+    int localSearchMoves_;
+    
+public:
+    ILSDBAlgorithm(int maxIterations = 5000, bool returnToStart = false)
+        : ILSDBAlgorithm(maxIterations, returnToStart,
+                         CandidateLocalSearch::OR_OPT | CandidateLocalSearch::TWO_OPT)
+    {}
+    
+    std::vector<int> solve(
+        const TspMatrix& matrix,
+        const std::vector<int64_t>& nodeIds
+    ) override;
+    
+    std::string getName() const override {
+        return "ILSDB";
+    }
+    
+    void setReturnToStart(bool value) override {
+        returnToStart_ = value;
+    }
+    
+    void setMaxIterations(int maxIterations) override {
+        maxIterations_ = maxIterations;
+    }
+    
+protected:
+    /**
+     * @brief Same kick/repair loop with another local search
+     * 
+     * @param localSearchMoves CandidateLocalSearch move mask; OR_3OPT is
+     *        added on asymmetric matrices
+     */
+    ILSDBAlgorithm(int maxIterations, bool returnToStart, int localSearchMoves)
+        : maxIterations_(maxIterations)
+        , returnToStart_(returnToStart)
+        , localSearchMoves_(localSearchMoves)
+    {}
+    
+private:
+    /**
+     * @brief Calculate total route distance
+     */
+    double routeDistance(const std::vector<int>& route, const TspMatrix& matrix) const;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "ILSDBAlgorithm.h"
+
+/**
+ * @brief Chained Lin-Kernighan for TSP
+ * 
+ * - Local search: Lin-Kernighan variable-depth moves (chains of up to
+ *   50 2-opt steps) plus Or-opt, over neighbour lists with don't-look bits
+ * - Perturbation and acceptance: the ILSDB double-bridge loop
+ * - 1000 iterations by default (each one is much stronger than an IG one)
+ */
+class LKAlgorithm : public ILSDBAlgorithm {
+public:
+    LKAlgorithm(int maxIterations = 1000, bool returnToStart = false)
+        : ILSDBAlgorithm(maxIterations, returnToStart,
+                         CandidateLocalSearch::LIN_KERNIGHAN | CandidateLocalSearch::OR_OPT)
+    {}
+    
+    std::string getName() const override {
+        return "LK";
+    }
+};
@@ -0,0 +1,29 @@
+#include "NeighborLists.h"
+#include <algorithm>
+
+NeighborLists::NeighborLists(const TspMatrix& matrix, size_t k)
+    : size_(matrix.getSize())
+    , k_(size_ > 1 ? std::min(k, size_ - 1) : 0)
+{
+    neighbors_.resize(size_ * k_);
+    if (k_ == 0) {
+        return;
+    }
+
+    std::vector<int> others;
+    others.reserve(size_ - 1);
+    std::vector<double> key(size_);
+
+    for (size_t city = 0; city < size_; city++) {
+        others.clear();
+        for (size_t other = 0; other < size_; other++) {
+            if (other == city) continue;
+            key[other] = std::min(matrix.getDistance(city, other), matrix.getDistance(other, city));
+            others.push_back(static_cast<int>(other));
+        }
+
+        std::partial_sort(others.begin(), others.begin() + k_, others.end(),
+            [&key](int a, int b) { return key[a] < key[b] || (key[a] == key[b] && a < b); });
+        std::copy(others.begin(), others.begin() + k_, neighbors_.begin() + city * k_);
+    }
+}
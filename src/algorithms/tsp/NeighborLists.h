@@ -0,0 +1,56 @@
+#pragma once
+
+#include "TspMatrix.h"
+#include <vector>
+
+/**
+ * @brief K nearest neighbours of every waypoint (candidate lists)
+ *
+ * Built once per solve from the matrix distances. Local search only
+ * tries moves that bring a city next to one of its candidates, which
+ * turns an O(n²) pass into O(n·k). Ranked by min(d(i,j), d(j,i)) so a
+ * neighbour that is close in either direction of a one-way pair counts.
+ */
+class NeighborLists {
+private:
+    size_t size_;
+    size_t k_;
+
+    // neighbors_[city * k_ + rank], closest first
+    std::vector<int> neighbors_;
+
+public:
+    /**
+     * @brief Default list length (enough for 2-opt / Or-opt in practice)
+     */
+    static constexpr size_t DEFAULT_SIZE = 10;
+
+    /**
+     * @brief Build the lists (O(n² log k))
+     *
+     * @param matrix Distance matrix
+     * @param k Neighbours per city (capped at n - 1)
+     */
+    explicit NeighborLists(const TspMatrix& matrix, size_t k = DEFAULT_SIZE);
+
+    /**
+     * @brief Neighbours of city, closest first (getK() entries)
+     */
+    const int* get(size_t city) const {
+        return neighbors_.data() + city * k_;
+    }
+
+    /**
+     * @brief Neighbours per city
+     */
+    size_t getK() const {
+        return k_;
+    }
+
+    /**
+     * @brief Number of cities
+     */
+    size_t getSize() const {
+        return size_;
+    }
+};
@@ -0,0 +1,160 @@
+#include "OneTreeBound.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace {
+    const double INF = std::numeric_limits<double>::infinity();
+
+    // Initial step size factor (Held & Karp's lambda), and the one it stops at
+    const double START_STEP = 2.0;
+    const double MIN_STEP = 1e-4;
+}
+
+OneTreeBound::OneTreeBound(const TspMatrix& matrix, bool returnToStart)
+    : matrix_(matrix)
+    , returnToStart_(returnToStart)
+    , size_(returnToStart ? matrix.getSize() : matrix.getSize() + 1)
+    , penalties_(size_, 0.0)
+    , degrees_(size_, 0)
+{
+    const size_t n = matrix.getSize();
+    costs_.resize(n * n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = i; j < n; j++) {
+            costs_[i * n + j] = costs_[j * n + i] = std::min(matrix.getDistance(i, j), matrix.getDistance(j, i));
+        }
+    }
+}
+
+double OneTreeBound::oneTree() {
+    const size_t n = matrix_.getSize();
+    // The special city is the last one (the dummy, for open routes)
+    const size_t special = size_ - 1;
+    std::fill(degrees_.begin(), degrees_.end(), 0);
+
+    // Prim over the other cities; each pass relaxes from the newest city
+    // and picks the next one at the same time
+    std::vector<double> key(special, INF);
+    std::vector<size_t> parent(special, special);
+    std::vector<size_t> outside;            // Cities not yet in the tree
+    outside.reserve(special);
+    for (size_t v = 1; v < special; v++) {
+        outside.push_back(v);
+    }
+    double total = 0.0;
+    size_t u = 0;
+    while (true) {
+        if (parent[u] != special) {
+            total += key[u];
+            degrees_[u]++;
+            degrees_[parent[u]]++;
+        }
+        if (outside.empty()) break;
+        
+        const double* row = &costs_[u * n];
+        const double penaltyU = penalties_[u];
+        size_t nextPos = 0;
+        for (size_t pos = 0; pos < outside.size(); pos++) {
+            size_t v = outside[pos];
+            double penalised = row[v] + penaltyU + penalties_[v];
+            if (penalised < key[v]) {
+                key[v] = penalised;
+                parent[v] = u;
+            }
+            if (key[v] < key[outside[nextPos]]) {
+                nextPos = pos;
+            }
+        }
+        u = outside[nextPos];
+        outside[nextPos] = outside.back();
+        outside.pop_back();
+    }
+
+    // Two edges of the special city: the cheapest two, or for the dummy
+    // the one to the start plus the cheapest other (the path's last city)
+    auto specialCost = [&](size_t v) {
+        return (returnToStart_ ? costs_[special * n + v] : 0.0) + penalties_[special] + penalties_[v];
+    };
+    size_t first = special;
+    size_t second = special;
+    double firstCost = INF;
+    double secondCost = INF;
+    for (size_t v = returnToStart_ ? 0 : 1; v < special; v++) {
+        double penalised = specialCost(v);
+        if (penalised < firstCost) {
+            second = first;
+            secondCost = firstCost;
+            first = v;
+            firstCost = penalised;
+        } else if (penalised < secondCost) {
+            second = v;
+            secondCost = penalised;
+        }
+    }
+    if (!returnToStart_) {
+        second = 0;
+        secondCost = specialCost(0);
+    }
+    total += firstCost + secondCost;
+    degrees_[special] = 2;
+    degrees_[first]++;
+    degrees_[second]++;
+
+    double penaltySum = 0.0;
+    for (double penalty : penalties_) {
+        penaltySum += penalty;
+    }
+    return total - 2.0 * penaltySum;
+}
+
+double OneTreeBound::compute(double upperBound, int maxIterations, double timeLimitSeconds) {
+    const size_t n = matrix_.getSize();
+    if (n < 3) {
+        // Only one possible tour
+        std::vector<int> tour;
+        for (size_t i = 0; i < n; i++) tour.push_back(static_cast<int>(i));
+        return matrix_.calculateTourCost(tour, returnToStart_);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::fill(penalties_.begin(), penalties_.end(), 0.0);
+    double best = 0.0;
+    double step = START_STEP;
+    int sinceImprovement = 0;
+
+    for (int iter = 0; iter < maxIterations && step > MIN_STEP; iter++) {
+        double bound = oneTree();
+        if (!std::isfinite(bound)) {
+            return 0.0;  // Unreachable pairs: no bound
+        }
+        if (bound > best) {
+            best = bound;
+            sinceImprovement = 0;
+        } else if (++sinceImprovement >= STEP_PERIOD) {
+            step /= 2.0;
+            sinceImprovement = 0;
+        }
+
+        // Subgradient: degree - 2 (all zero = the 1-tree is an optimal tour)
+        double norm = 0.0;
+        for (size_t i = 0; i < size_; i++) {
+            double g = degrees_[i] - 2;
+            norm += g * g;
+        }
+        if (norm == 0.0 || best >= upperBound) {
+            break;
+        }
+        if (timeLimitSeconds > 0.0 &&
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() >= timeLimitSeconds) {
+            break;
+        }
+
+        double t = step * (upperBound - bound) / norm;
+        for (size_t i = 0; i < size_; i++) {
+            penalties_[i] += t * (degrees_[i] - 2);
+        }
+    }
+    return best;
+}
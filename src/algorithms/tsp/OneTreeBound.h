@@ -0,0 +1,70 @@
+#pragma once
+
+#include "TspMatrix.h"
+#include <vector>
+
+/**
+ * @brief Held-Karp lower bound: 1-trees with subgradient-optimised penalties
+ *
+ * - A 1-tree is a spanning tree of all cities but one plus the two
+ *   cheapest edges of that one; every tour is a 1-tree, so the cheapest
+ *   1-tree bounds the optimum from below
+ * - Node penalties pi are added to every edge (c + pi_i + pi_j) and
+ *   2·sum(pi) is taken back off; each subgradient step raises the penalty
+ *   of cities of degree > 2 and lowers it for leaves, pushing the tree
+ *   towards a tour. The bound is usually within 1-2% of the optimum
+ * - Works on min(d(i,j), d(j,i)), so it stays valid for asymmetric
+ *   matrices (weaker there). Open routes get a dummy city at zero cost,
+ *   tied to the start and to the cheapest other end, closing the path
+ * - O(n²) per step (Prim on a symmetrised copy of the matrix)
+ */
+class OneTreeBound {
+public:
+    /**
+     * @brief Subgradient steps by default
+     */
+    static constexpr int DEFAULT_ITERATIONS = 100;
+
+    /**
+     * @brief Steps without a better bound before the step size is halved
+     */
+    static constexpr int STEP_PERIOD = 5;
+
+private:
+    const TspMatrix& matrix_;
+    bool returnToStart_;
+    size_t size_;                       // Cities of the 1-tree (plus the dummy for open routes)
+    std::vector<double> costs_;         // costs_[i * n + j] = min(d(i,j), d(j,i))
+    std::vector<double> penalties_;
+    std::vector<int> degrees_;
+
+public:
+    /**
+     * @brief Copies the symmetrised distances (n² doubles)
+     */
+    OneTreeBound(const TspMatrix& matrix, bool returnToStart);
+
+    /**
+     * @brief Run the subgradient optimisation
+     *
+     * @param upperBound Cost of any known tour (sets the step size)
+     * @param maxIterations Subgradient steps
+     * @param timeLimitSeconds Stop after this long (0 = steps only)
+     * @return Best lower bound found (0 if none could be computed)
+     */
+    double compute(double upperBound, int maxIterations = DEFAULT_ITERATIONS, double timeLimitSeconds = 0.0);
+
+    /**
+     * @brief Relative gap (cost - lowerBound) / lowerBound; negative if the bound is unknown
+     */
+    static double gap(double cost, double lowerBound) {
+        return lowerBound > 0.0 ? (cost - lowerBound) / lowerBound : -1.0;
+    }
+
+private:
+    /**
+     * @brief Cheapest 1-tree under the current penalties; fills degrees_
+     * @return Its penalised cost minus 2·sum(penalties)
+     */
+    double oneTree();
+};
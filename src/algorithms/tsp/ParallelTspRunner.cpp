@@ -0,0 +1,176 @@
+#include "ParallelTspRunner.h"
+#include "CheapestInsertion.h"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace {
+    // Iteration budget when the wrapped algorithm keeps its own default
+    const int DEFAULT_ITERATIONS = 5000;
+}
+
+ParallelTspRunner::ParallelTspRunner(
+    InstanceFactory factory,
+    int numIslands,
+    int numThreads,
+    int migrationInterval
+)
+    : factory_(std::move(factory))
+    , numIslands_(numIslands)
+    , numThreads_(numThreads)
+    , migrationInterval_(std::max(1, migrationInterval))
+    , maxIterations_(0)
+    , returnToStart_(false)
+{
+    baseName_ = factory_()->getName();
+}
+
+std::vector<int> ParallelTspRunner::randomInsertionRoute(const TspMatrix& matrix, std::mt19937& rng) const {
+    const size_t n = matrix.getSize();
+    std::vector<int> order;
+    for (size_t i = 1; i < n; i++) {
+        order.push_back(static_cast<int>(i));
+    }
+    std::shuffle(order.begin(), order.end(), rng);
+    
+    std::vector<int> route = {0};
+    route.reserve(n);
+    for (int city : order) {
+        cheapestInsertion(route, city, matrix, returnToStart_);
+    }
+    return route;
+}
+
+std::vector<int> ParallelTspRunner::constructIslandTour(const TspMatrix& matrix, size_t island, std::mt19937& rng) const {
+    const size_t n = matrix.getSize();
+    if (island == 0 || n < 3) {
+        return startingTour(matrix, returnToStart_);
+    }
+    if (island % 2 == 0) {
+        return randomInsertionRoute(matrix, rng);
+    }
+    
+    // Nearest Neighbor from another start, rotated so index 0 comes first
+    std::uniform_int_distribution<int> dist(1, static_cast<int>(n) - 1);
+    std::vector<int> route = matrix.nearestNeighborRoute(dist(rng));
+    std::rotate(route.begin(), std::find(route.begin(), route.end(), 0), route.end());
+    return route;
+}
+
+std::vector<int> ParallelTspRunner::solve(
+    const TspMatrix& matrix,
+    const std::vector<int64_t>& nodeIds
+) {
+    if (nodeIds.empty()) {
+        return {};
+    }
+    
+    const Clock::time_point deadline = beginSolve();
+    
+    unsigned int numThreads = numThreads_ > 0
+        ? static_cast<unsigned int>(numThreads_)
+        : std::max(1u, std::thread::hardware_concurrency());
+    size_t numIslands = numIslands_ > 0 ? static_cast<size_t>(numIslands_) : numThreads;
+    numThreads = std::min<unsigned int>(numThreads, static_cast<unsigned int>(numIslands));
+    
+    std::mt19937 rng = makeRng();
+    
+    // Islands: one instance each, with its own starting tour
+    std::vector<std::unique_ptr<ITspAlgorithm>> islands;
+    std::vector<std::vector<int>> tours(numIslands);
+    std::vector<double> costs(numIslands);
+    
+    // Island improvements are forwarded only when they beat every island so far
+    std::mutex reportMutex;
+    double reportedCost = std::numeric_limits<double>::infinity();
+    auto reportIfBest = [&](const std::vector<int>& tour, double cost) {
+        std::lock_guard<std::mutex> lock(reportMutex);
+        if (cost < reportedCost) {
+            reportedCost = cost;
+            reportImprovement(tour, cost);
+        }
+    };
+    
+    for (size_t k = 0; k < numIslands; k++) {
+        islands.push_back(factory_());
+        islands[k]->setReturnToStart(returnToStart_);
+        islands[k]->setTargetGap(lowerBound_, targetGap_);
+        if (improvementCallback_) {
+            islands[k]->setImprovementCallback([&reportIfBest](const std::vector<int>& tour, double cost, double) {
+                reportIfBest(tour, cost);
+            });
+        }
+        tours[k] = constructIslandTour(matrix, k, rng);
+        costs[k] = matrix.calculateTourCost(tours[k], returnToStart_);
+        reportIfBest(tours[k], costs[k]);
+    }
+    
+    int remaining = maxIterations_ > 0 ? maxIterations_ : DEFAULT_ITERATIONS;
+    int epochs = 0;
+    
+    while (remaining > 0 && !timeUp(deadline) && !gapReached(*std::min_element(costs.begin(), costs.end()))) {
+        int epochIterations = std::min(migrationInterval_, remaining);
+        remaining -= epochIterations;
+        epochs++;
+        
+        // Island seeds come from the runner's generator: a seeded run is reproducible
+        std::vector<uint64_t> seeds(numIslands);
+        for (size_t k = 0; k < numIslands; k++) {
+            seeds[k] = rng();
+        }
+        
+        // Epoch: every island continues from its current tour (islands spread over the workers)
+        std::atomic<size_t> nextIsland{0};
+        auto workerFunction = [&]() {
+            size_t k;
+            while ((k = nextIsland.fetch_add(1)) < numIslands) {
+                if (deadline != Clock::time_point::max()) {
+                    double left = std::chrono::duration<double>(deadline - Clock::now()).count();
+                    if (left <= 0.0) continue;
+                    islands[k]->setTimeLimit(left);
+                }
+                islands[k]->setSeed(seeds[k]);
+                islands[k]->setMaxIterations(epochIterations);
+                islands[k]->setInitialTour(tours[k]);
+                std::vector<int> tour = islands[k]->solve(matrix, nodeIds);
+                double cost = matrix.calculateTourCost(tour, returnToStart_);
+                if (tour.size() == tours[k].size() && cost <= costs[k]) {
+                    tours[k] = std::move(tour);
+                    costs[k] = cost;
+                }
+            }
+        };
+        
+        std::vector<std::thread> threads;
+        for (unsigned int t = 0; t < numThreads; t++) {
+            threads.emplace_back(workerFunction);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        
+        // Migration on a ring: take the predecessor's tour if it is better
+        if (remaining > 0 && numIslands > 1) {
+            std::vector<std::vector<int>> previousTours = tours;
+            std::vector<double> previousCosts = costs;
+            for (size_t k = 0; k < numIslands; k++) {
+                size_t from = (k + numIslands - 1) % numIslands;
+                if (previousCosts[from] < previousCosts[k]) {
+                    tours[k] = previousTours[from];
+                    costs[k] = previousCosts[from];
+                }
+            }
+        }
+    }
+    
+    size_t best = std::min_element(costs.begin(), costs.end()) - costs.begin();
+    
+    std::cout << "[Parallel " << baseName_ << "] " << numIslands << " islands on " << numThreads
+              << " threads, " << epochs << " epochs" << std::endl;
+    std::cout << "[Parallel " << baseName_ << "] Best distance: " << costs[best] << " m (island " << best << ")" << std::endl;
+    
+    return tours[best];
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "../../core/interfaces/ITspAlgorithm.h"
+#include "TspMatrix.h"
+#include <functional>
+#include <memory>
+#include <random>
+
+/**
+ * @brief Island-model multi-start around any ITspAlgorithm
+ * 
+ * - K independent instances (islands) of the wrapped algorithm, run on a
+ *   pool of worker threads; they share the read-only TspMatrix
+ * - Each island starts from a different construction: the initial tour
+ *   (else the configured construction), Nearest Neighbor from other
+ *   starts, random insertion
+ * - The run is split into epochs of migrationInterval iterations; after
+ *   each epoch every island receives its ring predecessor's tour if that
+ *   one is better (elite migration), and continues from it
+ * - Returns the best tour over all islands
+ * - The time limit bounds the whole run: each island gets what is left
+ *   of it, and no epoch starts after it. Island seeds are drawn from the
+ *   runner's seed, so a seeded run without time limit is reproducible
+ * - The target gap (setTargetGap) is passed to every island, and no epoch
+ *   starts once the best island is within it
+ * 
+ * The wrapped algorithms are not modified: they only need to honour
+ * setMaxIterations(), setInitialTour(), setTimeLimit() and setSeed().
+ */
+class ParallelTspRunner : public ITspAlgorithm {
+public:
+    /**
+     * @brief Creates one fresh algorithm instance per island
+     */
+    using InstanceFactory = std::function<std::unique_ptr<ITspAlgorithm>()>;
+    
+    /**
+     * @brief Iterations each island runs between migrations
+     */
+    static constexpr int DEFAULT_MIGRATION_INTERVAL = 500;
+    
+private:
+    InstanceFactory factory_;
+    int numIslands_;
+    int numThreads_;            // 0 = std::thread::hardware_concurrency()
+    int migrationInterval_;
+    int maxIterations_;         // Per island; 0 = the wrapped algorithm's default
+    bool returnToStart_;
+    std::string baseName_;
+    
+public:
+    /**
+     * @param factory Creates the wrapped algorithm (e.g. via TspAlgorithmFactory)
+     * @param numIslands Number of islands K (0 = one per thread)
+     * @param numThreads Worker threads (0 = all cores)
+     * @param migrationInterval Iterations between migrations
+     */
+    ParallelTspRunner(
+        InstanceFactory factory,
+        int numIslands = 0,
+        int numThreads = 0,
+        int migrationInterval = DEFAULT_MIGRATION_INTERVAL
+    );
+    
+    std::vector<int> solve(
+        const TspMatrix& matrix,
+        const std::vector<int64_t>& nodeIds
+    ) override;
+    
+    std::string getName() const override {
+        return "Parallel " + baseName_;
+    }
+    
+    void setMaxIterations(int maxIterations) override {
+        maxIterations_ = maxIterations;
+    }
+    
+    void setReturnToStart(bool value) override {
+        returnToStart_ = value;
+    }
+    
+private:
+    /**
+     * @brief Starting tour of one island (always begins with index 0)
+     */
+    std::vector<int> constructIslandTour(const TspMatrix& matrix, size_t island, std::mt19937& rng) const;
+    
+    /**
+     * @brief Random-order cheapest insertion (diverse, reasonably good)
+     */
+    std::vector<int> randomInsertionRoute(const TspMatrix& matrix, std::mt19937& rng) const;
+};
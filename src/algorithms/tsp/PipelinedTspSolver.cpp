@@ -0,0 +1,93 @@
+#include "PipelinedTspSolver.h"
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+PipelinedTspSolver::PipelinedTspSolver(InstanceFactory factory, bool returnToStart, double sliceSeconds)
+    : factory_(std::move(factory))
+    , returnToStart_(returnToStart)
+    , sliceSeconds_(sliceSeconds)
+    , slices_(0)
+{}
+
+std::vector<int> PipelinedTspSolver::warmStart(
+    const TspMatrix& exact,
+    TspMatrix& working,
+    const std::vector<int64_t>& nodeIds,
+    const Precompute& precompute
+) {
+    // Rows finished by the precompute workers, not yet copied into working
+    std::mutex rowsMutex;
+    std::vector<size_t> landedRows;
+    std::atomic<bool> precomputeDone{false};
+    std::exception_ptr precomputeError;
+
+    std::thread precomputeThread([&]() {
+        try {
+            precompute([&](size_t row) {
+                std::lock_guard<std::mutex> lock(rowsMutex);
+                landedRows.push_back(row);
+            });
+        } catch (...) {
+            precomputeError = std::current_exception();
+        }
+        precomputeDone.store(true, std::memory_order_release);
+    });
+
+    std::unique_ptr<ITspAlgorithm> algorithm;
+    std::vector<int> tour;
+    std::vector<size_t> pendingRows;
+    size_t exactRows = 0;
+    slices_ = 0;
+
+    try {
+        algorithm = factory_();
+        algorithm->setReturnToStart(returnToStart_);
+        algorithm->setTimeLimit(sliceSeconds_);
+
+        while (true) {
+            // Checked before draining: rows reported before the flag are all picked up
+            bool done = precomputeDone.load(std::memory_order_acquire);
+            {
+                std::lock_guard<std::mutex> lock(rowsMutex);
+                pendingRows.swap(landedRows);
+            }
+            for (size_t row : pendingRows) {
+                working.copyRow(exact, row);
+            }
+            exactRows += pendingRows.size();
+            pendingRows.clear();
+
+            if (done) {
+                break;
+            }
+
+            // One slice on the current working matrix, continuing from the last tour
+            if (seed_) {
+                algorithm->setSeed(*seed_ + slices_);
+            }
+            algorithm->setInitialTour(tour);
+            tour = algorithm->solve(working, nodeIds);
+            slices_++;
+        }
+    } catch (...) {
+        precomputeThread.join();
+        throw;
+    }
+    precomputeThread.join();
+
+    if (precomputeError) {
+        std::rethrow_exception(precomputeError);
+    }
+
+    std::cout << "[Pipelined] " << slices_ << " slices of " << algorithm->getName()
+              << " while the matrix was computed (" << exactRows << " exact rows)" << std::endl;
+
+    if (tour.size() != exact.getSize()) {
+        // Precompute finished before the first slice
+        return {};
+    }
+    return tour;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "../../core/interfaces/ITspAlgorithm.h"
+#include "TspMatrix.h"
+#include <functional>
+#include <memory>
+#include <optional>
+
+/**
+ * @brief Overlaps the matrix precompute with solving
+ *
+ * - The precompute runs on a background thread; meanwhile a warm-up
+ *   instance of the algorithm improves a tour on a working matrix that
+ *   starts as estimates (e.g. TspMatrix::estimateFromCoordinates)
+ * - Solving goes in short time slices; between slices the rows that have
+ *   landed are copied into the working matrix, so the tour is optimised
+ *   against more and more exact distances (the solver never reads a
+ *   matrix that is being written)
+ * - warmStart() returns when the precompute has finished; the caller then
+ *   re-optimises the tour on the exact matrix (setInitialTour + solve)
+ *
+ * Most of the matrix latency is spent on useful search instead of waiting.
+ */
+class PipelinedTspSolver {
+public:
+    /**
+     * @brief Creates the warm-up algorithm instance (e.g. via TspAlgorithmFactory)
+     */
+    using InstanceFactory = std::function<std::unique_ptr<ITspAlgorithm>()>;
+
+    /**
+     * @brief Fills the exact matrix, calling onRow once per finished row
+     *        (e.g. TspMatrix::precompute with a row callback)
+     */
+    using Precompute = std::function<void(const TspMatrix::RowCallback& onRow)>;
+
+    /**
+     * @brief Solving time between two row refreshes of the working matrix
+     */
+    static constexpr double DEFAULT_SLICE_SECONDS = 0.05;
+
+private:
+    InstanceFactory factory_;
+    bool returnToStart_;
+    double sliceSeconds_;
+    std::optional<uint64_t> seed_;
+    size_t slices_;
+
+public:
+    PipelinedTspSolver(InstanceFactory factory, bool returnToStart, double sliceSeconds = DEFAULT_SLICE_SECONDS);
+
+    void setSeed(uint64_t seed) {
+        seed_ = seed;
+    }
+
+    /**
+     * @brief Run precompute and the warm-up search concurrently
+     *
+     * @param exact Matrix filled by precompute (its rows are read only once reported)
+     * @param working Estimated distances; receives the exact rows as they land
+     * @return Best tour found on the working matrix (permutation starting with 0)
+     * @throws Whatever precompute throws, once it has stopped
+     */
+    std::vector<int> warmStart(
+        const TspMatrix& exact,
+        TspMatrix& working,
+        const std::vector<int64_t>& nodeIds,
+        const Precompute& precompute
+    );
+
+    /**
+     * @brief Solving slices run by the last warmStart()
+     */
+    size_t getSlices() const {
+        return slices_;
+    }
+};
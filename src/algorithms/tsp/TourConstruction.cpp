@@ -0,0 +1,334 @@
+#include "TourConstruction.h"
+#include "NeighborLists.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+namespace {
+    // Odd-degree vertices considered as matching partners of each other (Christofides)
+    const size_t MATCHING_CANDIDATES = 10;
+
+    // Hilbert grid of 2^16 x 2^16 cells
+    const uint32_t HILBERT_SIDE = 1u << 16;
+
+    struct CandidateEdge {
+        double cost;
+        int a;
+        int b;
+
+        bool operator<(const CandidateEdge& other) const {
+            return std::tie(cost, a, b) < std::tie(other.cost, other.a, other.b);
+        }
+    };
+
+    // Both directions of a pair: symmetric cost of the undirected edge
+    inline double edgeCost(const TspMatrix& matrix, int a, int b) {
+        return matrix.getDistance(a, b) + matrix.getDistance(b, a);
+    }
+
+    class DisjointSets {
+        std::vector<int> parent_;
+
+    public:
+        explicit DisjointSets(size_t size) : parent_(size) {
+            std::iota(parent_.begin(), parent_.end(), 0);
+        }
+
+        int find(int x) {
+            while (parent_[x] != x) {
+                parent_[x] = parent_[parent_[x]];
+                x = parent_[x];
+            }
+            return x;
+        }
+
+        void unite(int a, int b) {
+            parent_[find(a)] = find(b);
+        }
+    };
+
+    // Every pair of cities (a < b) with its cost, cheapest first
+    std::vector<CandidateEdge> allPairs(const TspMatrix& matrix, const std::vector<int>& cities) {
+        std::vector<CandidateEdge> edges;
+        edges.reserve(cities.size() * (cities.size() - 1) / 2);
+        for (size_t i = 0; i < cities.size(); i++) {
+            for (size_t j = i + 1; j < cities.size(); j++) {
+                int a = std::min(cities[i], cities[j]);
+                int b = std::max(cities[i], cities[j]);
+                edges.push_back({edgeCost(matrix, a, b), a, b});
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        return edges;
+    }
+
+    /**
+     * Cut a cycle at index 0 and walk it in the cheaper direction
+     * (for open routes the leg back to 0 is simply dropped)
+     */
+    std::vector<int> orientCycle(const std::vector<int>& cycle, const TspMatrix& matrix, bool returnToStart) {
+        std::vector<int> forward = cycle;
+        std::rotate(forward.begin(), std::find(forward.begin(), forward.end(), 0), forward.end());
+        std::vector<int> backward = forward;
+        std::reverse(backward.begin() + 1, backward.end());
+        return matrix.calculateTourCost(backward, returnToStart) < matrix.calculateTourCost(forward, returnToStart)
+            ? backward
+            : forward;
+    }
+}
+
+std::vector<int> constructTour(TourConstruction construction, const TspMatrix& matrix, bool returnToStart) {
+    switch (construction) {
+        case TourConstruction::GREEDY_EDGE:
+            return greedyEdgeRoute(matrix, returnToStart);
+        case TourConstruction::CHRISTOFIDES:
+            return christofidesRoute(matrix, returnToStart);
+        case TourConstruction::SPACE_FILLING_CURVE:
+            if (matrix.getCoordinates().size() == matrix.getSize()) {
+                return orientCycle(spaceFillingCurveRoute(matrix.getCoordinates()), matrix, returnToStart);
+            }
+            return matrix.nearestNeighborRoute(0);
+        case TourConstruction::NEAREST_NEIGHBOR:
+        default:
+            return matrix.nearestNeighborRoute(0);
+    }
+}
+
+std::vector<int> greedyEdgeRoute(const TspMatrix& matrix, bool returnToStart) {
+    const size_t n = matrix.getSize();
+    if (n <= 3) {
+        std::vector<int> cycle(n);
+        std::iota(cycle.begin(), cycle.end(), 0);
+        return n == 0 ? cycle : orientCycle(cycle, matrix, returnToStart);
+    }
+
+    // Candidate edges: each city with its nearest neighbours (deduplicated)
+    NeighborLists neighbors(matrix);
+    std::vector<CandidateEdge> edges;
+    edges.reserve(n * neighbors.getK());
+    for (size_t city = 0; city < n; city++) {
+        const int* candidates = neighbors.get(city);
+        for (size_t r = 0; r < neighbors.getK(); r++) {
+            int a = std::min(static_cast<int>(city), candidates[r]);
+            int b = std::max(static_cast<int>(city), candidates[r]);
+            edges.push_back({edgeCost(matrix, a, b), a, b});
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end(), [](const CandidateEdge& x, const CandidateEdge& y) {
+        return x.a == y.a && x.b == y.b;
+    }), edges.end());
+
+    std::vector<std::array<int, 2>> adjacent(n, {-1, -1});
+    std::vector<int> degree(n, 0);
+    DisjointSets fragments(n);
+    size_t links = 0;
+
+    auto tryLink = [&](int a, int b) {
+        if (degree[a] >= 2 || degree[b] >= 2 || fragments.find(a) == fragments.find(b)) {
+            return;
+        }
+        adjacent[a][degree[a]++] = b;
+        adjacent[b][degree[b]++] = a;
+        fragments.unite(a, b);
+        links++;
+    };
+
+    for (const CandidateEdge& edge : edges) {
+        if (links == n - 1) break;
+        tryLink(edge.a, edge.b);
+    }
+
+    // Join the remaining fragments through their ends (every pair is allowed)
+    if (links < n - 1) {
+        std::vector<int> ends;
+        for (size_t city = 0; city < n; city++) {
+            if (degree[city] < 2) ends.push_back(static_cast<int>(city));
+        }
+        for (const CandidateEdge& edge : allPairs(matrix, ends)) {
+            if (links == n - 1) break;
+            tryLink(edge.a, edge.b);
+        }
+    }
+
+    // One Hamiltonian path: walk it from one end
+    int start = 0;
+    while (degree[start] == 2) start++;
+    std::vector<int> path;
+    path.reserve(n);
+    for (int prev = -1, current = start; current != -1; ) {
+        path.push_back(current);
+        int next = adjacent[current][0] != prev ? adjacent[current][0] : adjacent[current][1];
+        prev = current;
+        current = next;
+    }
+    return orientCycle(path, matrix, returnToStart);
+}
+
+std::vector<int> christofidesRoute(const TspMatrix& matrix, bool returnToStart) {
+    const size_t n = matrix.getSize();
+    if (n <= 3) {
+        std::vector<int> cycle(n);
+        std::iota(cycle.begin(), cycle.end(), 0);
+        return n == 0 ? cycle : orientCycle(cycle, matrix, returnToStart);
+    }
+
+    // Minimum spanning tree (Prim on the dense matrix)
+    std::vector<std::pair<int, int>> edges;
+    edges.reserve(n - 1 + n / 2);
+    {
+        std::vector<double> key(n, std::numeric_limits<double>::infinity());
+        std::vector<int> parent(n, -1);
+        std::vector<bool> inTree(n, false);
+        key[0] = 0.0;
+        for (size_t step = 0; step < n; step++) {
+            int u = -1;
+            for (size_t v = 0; v < n; v++) {
+                if (!inTree[v] && (u == -1 || key[v] < key[u])) u = static_cast<int>(v);
+            }
+            inTree[u] = true;
+            if (parent[u] != -1) edges.push_back({parent[u], u});
+            for (size_t v = 0; v < n; v++) {
+                if (inTree[v]) continue;
+                double cost = edgeCost(matrix, u, static_cast<int>(v));
+                if (cost < key[v]) {
+                    key[v] = cost;
+                    parent[v] = u;
+                }
+            }
+        }
+    }
+
+    // Odd-degree vertices, matched greedily: first among near candidates, then the rest
+    std::vector<int> degree(n, 0);
+    for (const auto& edge : edges) {
+        degree[edge.first]++;
+        degree[edge.second]++;
+    }
+    std::vector<int> odd;
+    for (size_t v = 0; v < n; v++) {
+        if (degree[v] % 2 == 1) odd.push_back(static_cast<int>(v));
+    }
+
+    std::vector<CandidateEdge> candidates;
+    const size_t k = std::min(MATCHING_CANDIDATES, odd.size() - 1);
+    std::vector<CandidateEdge> row;
+    for (int a : odd) {
+        row.clear();
+        for (int b : odd) {
+            if (a != b) row.push_back({edgeCost(matrix, a, b), std::min(a, b), std::max(a, b)});
+        }
+        std::nth_element(row.begin(), row.begin() + (k - 1), row.end());
+        candidates.insert(candidates.end(), row.begin(), row.begin() + k);
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    std::vector<bool> matched(n, false);
+    auto match = [&](const std::vector<CandidateEdge>& pairs) {
+        for (const CandidateEdge& pair : pairs) {
+            if (!matched[pair.a] && !matched[pair.b]) {
+                matched[pair.a] = matched[pair.b] = true;
+                edges.push_back({pair.a, pair.b});
+            }
+        }
+    };
+    match(candidates);
+    std::vector<int> unmatched;
+    for (int v : odd) {
+        if (!matched[v]) unmatched.push_back(v);
+    }
+    match(allPairs(matrix, unmatched));
+
+    // Euler walk of tree + matching (Hierholzer), repeated cities skipped
+    std::vector<std::vector<int>> incident(n);
+    for (size_t e = 0; e < edges.size(); e++) {
+        incident[edges[e].first].push_back(static_cast<int>(e));
+        incident[edges[e].second].push_back(static_cast<int>(e));
+    }
+    std::vector<bool> usedEdge(edges.size(), false);
+    std::vector<size_t> nextEdge(n, 0);
+    std::vector<bool> visited(n, false);
+    std::vector<int> stack = {0};
+    std::vector<int> cycle;
+    cycle.reserve(n);
+    while (!stack.empty()) {
+        int v = stack.back();
+        while (nextEdge[v] < incident[v].size() && usedEdge[incident[v][nextEdge[v]]]) {
+            nextEdge[v]++;
+        }
+        if (nextEdge[v] < incident[v].size()) {
+            int e = incident[v][nextEdge[v]++];
+            usedEdge[e] = true;
+            stack.push_back(edges[e].first == v ? edges[e].second : edges[e].first);
+        } else {
+            stack.pop_back();
+            if (!visited[v]) {
+                visited[v] = true;
+                cycle.push_back(v);
+            }
+        }
+    }
+    return orientCycle(cycle, matrix, returnToStart);
+}
+
+std::vector<int> spaceFillingCurveRoute(const std::vector<Coordinate>& coordinates) {
+    const size_t n = coordinates.size();
+    if (n == 0) {
+        return {};
+    }
+
+    // Equirectangular projection, scaled so the longer side spans the grid
+    double minLat = coordinates[0].getLatitude(), maxLat = minLat;
+    double minLon = coordinates[0].getLongitude(), maxLon = minLon;
+    for (const Coordinate& c : coordinates) {
+        minLat = std::min(minLat, c.getLatitude());
+        maxLat = std::max(maxLat, c.getLatitude());
+        minLon = std::min(minLon, c.getLongitude());
+        maxLon = std::max(maxLon, c.getLongitude());
+    }
+    const double lonScale = std::cos((minLat + maxLat) / 2.0 * PI / 180.0);
+    double span = std::max(maxLat - minLat, (maxLon - minLon) * lonScale);
+    if (span <= 0.0) span = 1.0;
+    const double cells = static_cast<double>(HILBERT_SIDE - 1);
+
+    std::vector<std::pair<uint64_t, int>> keys(n);
+    for (size_t i = 0; i < n; i++) {
+        uint32_t x = static_cast<uint32_t>((coordinates[i].getLongitude() - minLon) * lonScale / span * cells);
+        uint32_t y = static_cast<uint32_t>((coordinates[i].getLatitude() - minLat) / span * cells);
+
+        // Distance along the curve (quadrant by quadrant, rotating the frame)
+        uint64_t d = 0;
+        for (uint32_t s = HILBERT_SIDE / 2; s > 0; s /= 2) {
+            uint32_t rx = (x & s) ? 1 : 0;
+            uint32_t ry = (y & s) ? 1 : 0;
+            d += static_cast<uint64_t>(s) * s * ((3 * rx) ^ ry);
+            if (ry == 0) {
+                if (rx == 1) {
+                    x = HILBERT_SIDE - 1 - x;
+                    y = HILBERT_SIDE - 1 - y;
+                }
+                std::swap(x, y);
+            }
+        }
+        keys[i] = {d, static_cast<int>(i)};
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<int> route(n);
+    for (size_t i = 0; i < n; i++) {
+        route[i] = keys[i].second;
+    }
+    std::rotate(route.begin(), std::find(route.begin(), route.end(), 0), route.end());
+    return route;
+}
+
+std::vector<int> ITspAlgorithm::startingTour(const TspMatrix& matrix, bool returnToStart) const {
+    if (initialTour_.size() == matrix.getSize()) {
+        return initialTour_;
+    }
+    return constructTour(construction_, matrix, returnToStart);
+}
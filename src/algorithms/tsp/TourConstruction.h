@@ -0,0 +1,47 @@
+#pragma once
+
+#include "../../core/interfaces/ITspAlgorithm.h"
+#include "TspMatrix.h"
+#include <vector>
+
+/**
+ * @brief Starting tours for the TSP solvers (see TourConstruction)
+ *
+ * Every builder returns a permutation of 0..N-1 starting with 0. Greedy-edge
+ * and Christofides work on the symmetrised cost d(i,j) + d(j,i) and build a
+ * cycle; it is then cut at index 0 and walked in the cheaper direction, so
+ * one-way streets and open routes are still respected.
+ */
+
+/**
+ * @brief Tour of the requested construction
+ *
+ * SPACE_FILLING_CURVE falls back to Nearest Neighbor when the matrix has no
+ * coordinates (TspMatrix::getCoordinates()).
+ */
+std::vector<int> constructTour(TourConstruction construction, const TspMatrix& matrix, bool returnToStart);
+
+/**
+ * @brief Greedy-edge matching: cheapest edges first, skipping those that
+ *        would give a city three edges or close a subtour
+ *
+ * Edges come from the nearest-neighbour lists (O(n² log k) to build);
+ * the fragments left over are joined by the same rule over their ends.
+ */
+std::vector<int> greedyEdgeRoute(const TspMatrix& matrix, bool returnToStart);
+
+/**
+ * @brief Christofides-style: minimum spanning tree (Prim, O(n²)), odd-degree
+ *        vertices matched greedily (not a perfect minimum matching), Euler
+ *        walk with repeated cities skipped
+ */
+std::vector<int> christofidesRoute(const TspMatrix& matrix, bool returnToStart);
+
+/**
+ * @brief Order of the waypoints along a Hilbert curve, rotated to start at 0
+ *
+ * O(n log n) from coordinates alone: nearby points are visited together,
+ * giving an instant rough tour for very large stop lists (some 40% above
+ * optimal on uniform points, against 25% for Nearest Neighbor).
+ */
+std::vector<int> spaceFillingCurveRoute(const std::vector<Coordinate>& coordinates);
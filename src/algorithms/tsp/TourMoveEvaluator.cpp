@@ -0,0 +1,131 @@
+#include "TourMoveEvaluator.h"
+
+TourMoveEvaluator::TourMoveEvaluator(const TspMatrix& matrix, bool returnToStart)
+    : matrix_(matrix)
+    , returnToStart_(returnToStart)
+    , symmetric_(true)
+{
+    const size_t n = matrix.getSize();
+    for (size_t i = 0; i < n && symmetric_; i++) {
+        for (size_t j = i + 1; j < n; j++) {
+            if (matrix.getDistance(i, j) != matrix.getDistance(j, i)) {
+                symmetric_ = false;
+                break;
+            }
+        }
+    }
+}
+
+void TourMoveEvaluator::update(const std::vector<int>& route) {
+    if (symmetric_) {
+        return;
+    }
+    const size_t n = route.size();
+    forward_.assign(n, 0.0);
+    backward_.assign(n, 0.0);
+    for (size_t t = 1; t < n; t++) {
+        forward_[t] = forward_[t - 1] + matrix_.getDistance(route[t - 1], route[t]);
+        backward_[t] = backward_[t - 1] + matrix_.getDistance(route[t], route[t - 1]);
+    }
+}
+
+double TourMoveEvaluator::tourCost(const std::vector<int>& route) const {
+    double cost = 0.0;
+    for (size_t t = 1; t < route.size(); t++) {
+        cost += matrix_.getDistance(route[t - 1], route[t]);
+    }
+    if (returnToStart_ && route.size() > 1) {
+        cost += matrix_.getDistance(route.back(), route.front());
+    }
+    return cost;
+}
+
+double TourMoveEvaluator::swapDelta(const std::vector<int>& route, size_t i, size_t j) const {
+    const size_t n = route.size();
+    if (i == j || n < 2) {
+        return 0.0;
+    }
+
+    // Node at each position once the move is applied
+    auto after = [&](size_t pos) {
+        return pos == i ? route[j] : (pos == j ? route[i] : route[pos]);
+    };
+
+    // Legs touching i or j, identified by their start position (deduplicated:
+    // adjacent or wrapping positions share legs)
+    size_t legs[4];
+    size_t legCount = 0;
+    auto addLeg = [&](size_t from) {
+        for (size_t k = 0; k < legCount; k++) {
+            if (legs[k] == from) return;
+        }
+        legs[legCount++] = from;
+    };
+    for (size_t pos : {i, j}) {
+        if (pos > 0) addLeg(pos - 1);
+        else if (returnToStart_) addLeg(n - 1);
+        if (pos < n - 1 || returnToStart_) addLeg(pos);
+    }
+
+    double delta = 0.0;
+    for (size_t k = 0; k < legCount; k++) {
+        size_t from = legs[k];
+        size_t to = (from + 1 == n) ? 0 : from + 1;
+        delta += matrix_.getDistance(after(from), after(to)) - matrix_.getDistance(route[from], route[to]);
+    }
+    return delta;
+}
+
+double TourMoveEvaluator::reverseDelta(const std::vector<int>& route, size_t i, size_t j) const {
+    const size_t n = route.size();
+    if (i >= j) {
+        return 0.0;
+    }
+
+    // Inner legs change direction (same cost both ways if symmetric)
+    double delta = symmetric_ ? 0.0 : (backward_[j] - backward_[i]) - (forward_[j] - forward_[i]);
+
+    if (returnToStart_ && i == 0 && j == n - 1) {
+        // Whole closed tour: only the closing leg flips
+        return delta + matrix_.getDistance(route[0], route[n - 1]) - matrix_.getDistance(route[n - 1], route[0]);
+    }
+
+    // Leg entering the segment: prev -> route[i] becomes prev -> route[j]
+    if (i > 0 || returnToStart_) {
+        int prev = route[i > 0 ? i - 1 : n - 1];
+        delta += matrix_.getDistance(prev, route[j]) - matrix_.getDistance(prev, route[i]);
+    }
+    // Leg leaving the segment: route[j] -> next becomes route[i] -> next
+    if (j < n - 1 || returnToStart_) {
+        int next = route[j < n - 1 ? j + 1 : 0];
+        delta += matrix_.getDistance(route[i], next) - matrix_.getDistance(route[j], next);
+    }
+    return delta;
+}
+
+double TourMoveEvaluator::orOptDelta(const std::vector<int>& route, size_t i, size_t last, size_t j) const {
+    const size_t n = route.size();
+    const bool hasPrev = i > 0 || returnToStart_;
+    const bool hasNext = last + 1 < n || returnToStart_;
+    const bool hasAfter = j + 1 < n || returnToStart_;
+    int first = route[i];
+    int tail = route[last];
+    int prev = route[i > 0 ? i - 1 : n - 1];
+    int next = route[last + 1 < n ? last + 1 : 0];
+    int at = route[j];
+    int after = route[j + 1 < n ? j + 1 : 0];
+
+    double delta = 0.0;
+
+    // Close the gap: prev -> first -> ... -> tail -> next becomes prev -> next
+    if (hasPrev) delta -= matrix_.getDistance(prev, first);
+    if (hasNext) delta -= matrix_.getDistance(tail, next);
+    if (hasPrev && hasNext) delta += matrix_.getDistance(prev, next);
+
+    // Open at -> after into at -> first -> ... -> tail -> after
+    delta += matrix_.getDistance(at, first);
+    if (hasAfter) {
+        delta += matrix_.getDistance(tail, after) - matrix_.getDistance(at, after);
+    }
+    return delta;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "TspMatrix.h"
+#include <vector>
+
+/**
+ * @brief Incremental cost of local-search moves on a tour
+ *
+ * Works for open paths (tour[0] -> ... -> tour[n-1]) and closed tours
+ * (plus tour[n-1] -> tour[0]). A move is evaluated from the few matrix
+ * entries it changes instead of re-summing the whole tour, and the route
+ * is only modified by the caller once the move is accepted.
+ *
+ * The matrix may be asymmetric (one-way streets): reversing a segment
+ * changes the direction of its inner legs, so prefix sums of the
+ * forward and backward leg costs give that part in O(1). They must be
+ * refreshed with update() after every applied move. On a symmetric
+ * matrix the inner legs cost the same both ways, so update() is a no-op.
+ */
+class TourMoveEvaluator {
+private:
+    const TspMatrix& matrix_;
+    bool returnToStart_;
+    bool symmetric_;
+
+    // forward_[k] = sum of d(r[t], r[t+1]), backward_[k] = sum of d(r[t+1], r[t]), for t < k
+    std::vector<double> forward_;
+    std::vector<double> backward_;
+
+public:
+    /**
+     * @brief Tolerance for accepting a move (avoids cycling on rounding noise)
+     */
+    static constexpr double IMPROVEMENT_EPSILON = 1e-9;
+
+    TourMoveEvaluator(const TspMatrix& matrix, bool returnToStart);
+
+    /**
+     * @brief Whether d(i, j) == d(j, i) for every pair (checked once, O(n²))
+     */
+    bool isSymmetric() const {
+        return symmetric_;
+    }
+
+    /**
+     * @brief Recompute the prefix sums for route (O(n), after each applied move)
+     */
+    void update(const std::vector<int>& route);
+
+    /**
+     * @brief Full cost of route (same as TspMatrix::calculateTourCost)
+     */
+    double tourCost(const std::vector<int>& route) const;
+
+    /**
+     * @brief Cost change of exchanging the nodes at positions i and j (O(1))
+     */
+    double swapDelta(const std::vector<int>& route, size_t i, size_t j) const;
+
+    /**
+     * @brief Cost change of reversing route[i..j], i <= j (O(1), needs update())
+     */
+    double reverseDelta(const std::vector<int>& route, size_t i, size_t j) const;
+
+    /**
+     * @brief Cost change of moving route[i..last] (same orientation) after position j (O(1))
+     *
+     * j must lie outside [i - 1, last] (cyclically for closed tours).
+     */
+    double orOptDelta(const std::vector<int>& route, size_t i, size_t last, size_t j) const;
+};
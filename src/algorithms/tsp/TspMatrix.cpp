@@ -1,6 +1,6 @@
 #include "TspMatrix.h"
+#include "../pathfinding/SearchWorkspace.h"
 #include <limits>
-#include <unordered_set>
 #include <iostream>
 #include <thread>
 #include <mutex>
@@ -11,12 +11,18 @@
 
 TspMatrix::TspMatrix(size_t size, const std::vector<int64_t>& nodeIds)
     : size_(size)
+    , stride_((size + 7) & ~static_cast<size_t>(7))
     , nodeIds_(nodeIds)
 {
-    // Initialize N x N matrix
-    matrix_.resize(size_);
-    for (size_t i = 0; i < size_; i++) {
-        matrix_[i].resize(size_);
+    // Initialize N x N matrix (padded rows)
+    distances_.assign(size_ * stride_, 0.0);
+    
+    // Duplicated IDs resolve to their first index
+    nodeIndex_.reserve(nodeIds_.size());
+    for (size_t i = 0; i < nodeIds_.size(); i++) {
+        if (nodeIndex_.find(nodeIds_[i]) == IdIndexTable::NOT_FOUND) {
+            nodeIndex_.insert(nodeIds_[i], static_cast<uint32_t>(i));
+        }
     }
 }
 
@@ -24,12 +30,24 @@ void TspMatrix::precompute(
     const Graph& graph,
     IPathfindingAlgorithm* algorithm,
     const VehicleProfile* vehicleProfile,
-    ProgressCallback progressCallback
+    ProgressCallback progressCallback,
+    RowCallback rowCallback
 ) {
     std::cout << "Starting parallel TSP matrix" << std::endl;
     std::cout << "   - Size: " << size_ << "x" << size_ << std::endl;
     std::cout << "   - Algorithm: " << algorithm->getName() << std::endl;
     
+    // Waypoint positions, for constructions that read no distances
+    coordinates_.clear();
+    for (int64_t nodeId : nodeIds_) {
+        Node* node = graph.getNode(nodeId);
+        if (!node) {
+            coordinates_.clear();
+            break;
+        }
+        coordinates_.push_back(node->getCoordinate());
+    }
+    
     std::atomic<int> completedRows{0};
     std::mutex progressMutex;
     
@@ -44,35 +62,38 @@ void TspMatrix::precompute(
     
     // STRATEGY: One thread processes FULL ROWS
     // This drastically reduces synchronization overhead
-    auto processRow = [&](size_t rowIdx) {
+    // Each worker reuses one SearchWorkspace for every search in its rows
+    auto processRow = [&](size_t rowIdx, SearchWorkspace& workspace) {
         int64_t fromId = nodeIds_[rowIdx];
         
-        for (size_t j = 0; j < size_; j++) {
-            if (rowIdx == j) {
-                // Distancia a sí mismo = 0
-                matrix_[rowIdx][j] = Entry(0.0, {});
-            } else {
-                // Calcular shortest path
-                int64_t toId = nodeIds_[j];
-                
-                std::vector<int64_t> path;
-                if (vehicleProfile) {
-                    path = algorithm->findPath(graph, fromId, toId, vehicleProfile);
-                } else {
-                    path = algorithm->findPath(graph, fromId, toId);
+        // Whole row at once, distances only (paths are materialized later
+        // for the tour legs). Algorithms without a distance-only mode
+        // return paths, which are measured and dropped.
+        std::vector<double> rowDistances;
+        if (!algorithm->findDistancesToMany(graph, fromId, nodeIds_, vehicleProfile, workspace, rowDistances)) {
+            std::vector<std::vector<int64_t>> paths = algorithm->findPathsToMany(
+                graph, fromId, nodeIds_, vehicleProfile, workspace);
+            
+            rowDistances.assign(size_, std::numeric_limits<double>::infinity());
+            for (size_t j = 0; j < size_; j++) {
+                if (!paths[j].empty()) {
+                    rowDistances[j] = calculatePathDistance(graph, paths[j]);
+                } else if (nodeIds_[j] == fromId) {
+                    rowDistances[j] = 0.0;  // Same node listed twice
                 }
-                
-                double distance = 0.0;
-                if (!path.empty()) {
-                    distance = calculatePathDistance(graph, path);
-                } else {
-                    distance = std::numeric_limits<double>::infinity();
-                }
-                
-                matrix_[rowIdx][j] = Entry(distance, path);
             }
         }
         
+        double* distanceRow = &distances_[rowIdx * stride_];
+        for (size_t j = 0; j < size_; j++) {
+            // Distancia a sí mismo = 0
+            distanceRow[j] = (rowIdx == j) ? 0.0 : rowDistances[j];
+        }
+        
+        if (rowCallback) {
+            rowCallback(rowIdx);
+        }
+        
         // Report progress upon completing the row
         int completed = ++completedRows;
         std::cout << "TSP Matrix: " << completed << "/" << size_ << " rows" << std::endl;
@@ -91,10 +112,11 @@ void TspMatrix::precompute(
     std::atomic<size_t> nextRow{0};
     
     auto workerFunction = [&]() {
+        SearchWorkspace workspace;
         while (true) {
             size_t row = nextRow.fetch_add(1);
             if (row >= size_) break;
-            processRow(row);
+            processRow(row, workspace);
         }
     };
     
@@ -107,33 +129,80 @@ void TspMatrix::precompute(
         thread.join();
     }
     
+    
     std::cout << "TSP Matrix completed" << std::endl;
 }
 
-const TspMatrix::Entry& TspMatrix::getEntry(int64_t fromNodeId, int64_t toNodeId) const {
-    size_t fromIdx = getNodeIndex(fromNodeId);
-    size_t toIdx = getNodeIndex(toNodeId);
-    return matrix_[fromIdx][toIdx];
+void TspMatrix::estimateFromCoordinates(const Graph& graph) {
+    std::vector<Coordinate> coordinates;
+    coordinates.reserve(size_);
+    for (size_t i = 0; i < size_; i++) {
+        Node* node = graph.getNode(nodeIds_[i]);
+        if (!node) {
+            throw std::runtime_error("Node ID not found in graph");
+        }
+        coordinates.push_back(node->getCoordinate());
+    }
+    
+    for (size_t i = 0; i < size_; i++) {
+        double* distanceRow = &distances_[i * stride_];
+        for (size_t j = 0; j < size_; j++) {
+            distanceRow[j] = (i == j) ? 0.0 : coordinates[i].distanceTo(coordinates[j]);
+        }
+    }
+    coordinates_ = std::move(coordinates);
+}
+
+void TspMatrix::copyRow(const TspMatrix& source, size_t fromIdx) {
+    std::copy(source.getRow(fromIdx), source.getRow(fromIdx) + size_, &distances_[fromIdx * stride_]);
+}
+
+TspMatrix::Entry TspMatrix::getEntryByNodeIds(int64_t fromNodeId, int64_t toNodeId) const {
+    return getEntry(getNodeIndex(fromNodeId), getNodeIndex(toNodeId));
+}
+
+std::vector<std::vector<int64_t>> TspMatrix::materializeTourPaths(
+    const Graph& graph,
+    IPathfindingAlgorithm* algorithm,
+    const VehicleProfile* vehicleProfile,
+    const std::vector<int>& tour,
+    bool returnToStart
+) const {
+    std::vector<std::vector<int64_t>> legs;
+    if (tour.empty()) {
+        return legs;
+    }
+    
+    size_t numLegs = returnToStart ? tour.size() : tour.size() - 1;
+    legs.reserve(numLegs);
+    
+    SearchWorkspace workspace;
+    for (size_t i = 0; i < numLegs; i++) {
+        int64_t fromId = nodeIds_[tour[i]];
+        int64_t toId = nodeIds_[tour[(i + 1) % tour.size()]];
+        legs.push_back(algorithm->findPath(graph, fromId, toId, vehicleProfile, workspace));
+    }
+    
+    return legs;
 }
 
 size_t TspMatrix::getNodeIndex(int64_t nodeId) const {
-    for (size_t i = 0; i < nodeIds_.size(); i++) {
-        if (nodeIds_[i] == nodeId) {
-            return i;
-        }
+    uint32_t index = nodeIndex_.find(nodeId);
+    if (index == IdIndexTable::NOT_FOUND) {
+        throw std::runtime_error("Node ID not found in TspMatrix");
     }
-    throw std::runtime_error("Node ID not found in TspMatrix");
+    return index;
 }
 
 double TspMatrix::calculateTourCost(const std::vector<int>& tour, bool returnToStart) const {
     double totalCost = 0.0;
     
     for (size_t i = 0; i < tour.size() - 1; i++) {
-        totalCost += matrix_[tour[i]][tour[i + 1]].distance;
+        totalCost += getDistance(tour[i], tour[i + 1]);
     }
     
     if (returnToStart && tour.size() > 1) {
-        totalCost += matrix_[tour.back()][tour.front()].distance;
+        totalCost += getDistance(tour.back(), tour.front());
     }
     
     return totalCost;
@@ -141,31 +210,38 @@ double TspMatrix::calculateTourCost(const std::vector<int>& tour, bool returnToS
 
 std::vector<int> TspMatrix::nearestNeighborRoute(int startIdx) const {
     std::vector<int> route;
-    std::unordered_set<int> remaining;
+    route.reserve(size_);
     
+    // Unvisited indices, contiguous; the chosen one is swapped with the last
+    std::vector<int> remaining;
+    remaining.reserve(size_);
     for (int i = 0; i < static_cast<int>(size_); i++) {
-        remaining.insert(i);
+        if (i != startIdx) {
+            remaining.push_back(i);
+        }
     }
     
     int current = startIdx;
     route.push_back(current);
-    remaining.erase(current);
     
     while (!remaining.empty()) {
-        int nearest = -1;
+        const double* row = getRow(current);
+        size_t nearestPos = 0;
         double minDist = std::numeric_limits<double>::max();
         
-        for (int candidate : remaining) {
-            double dist = matrix_[current][candidate].distance;
-            if (dist < minDist) {
+        for (size_t pos = 0; pos < remaining.size(); pos++) {
+            double dist = row[remaining[pos]];
+            // Ties go to the lowest index (independent of the swap order)
+            if (dist < minDist || (dist == minDist && remaining[pos] < remaining[nearestPos])) {
                 minDist = dist;
-                nearest = candidate;
+                nearestPos = pos;
             }
         }
         
-        route.push_back(nearest);
-        remaining.erase(nearest);
-        current = nearest;
+        current = remaining[nearestPos];
+        route.push_back(current);
+        remaining[nearestPos] = remaining.back();
+        remaining.pop_back();
     }
     
     return route;
@@ -189,7 +265,7 @@ std::vector<std::pair<size_t, size_t>> TspMatrix::getUnreachablePairs() const {
     
     for (size_t i = 0; i < size_; i++) {
         for (size_t j = 0; j < size_; j++) {
-            if (i != j && std::isinf(matrix_[i][j].distance)) {
+            if (i != j && std::isinf(getDistance(i, j))) {
                 unreachable.push_back({i, j});
             }
         }
@@ -204,7 +280,7 @@ bool TspMatrix::hasValidSolution() const {
     
     for (size_t i = 0; i < size_; i++) {
         for (size_t j = 0; j < size_; j++) {
-            if (i != j && std::isinf(matrix_[i][j].distance)) {
+            if (i != j && std::isinf(getDistance(i, j))) {
                 return false;
             }
         }
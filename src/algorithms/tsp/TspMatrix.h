@@ -2,32 +2,36 @@
 #pragma once
 
 #include "../../core/entities/Graph.h"
+#include "../../core/entities/IdIndexTable.h"
 #include "../../core/interfaces/IPathfindingAlgorithm.h"
+#include "../../utils/AlignedAllocator.h"
 #include <vector>
-#include <unordered_map>
 #include <cstdint>
 #include <memory>
 #include <functional>
 
 /**
- * @brief TSP Matrix with distances and precomputed paths
+ * @brief TSP distance matrix over the tour waypoints
  * 
- * - parallel precompute with bidirectional cache
+ * - parallel precompute, one one-to-many search per row
  * - nearestNeighborRoute() for heuristic initialization
- * - getEntry() to access distances/paths
+ * - getDistance() to access distances
+ *
+ * Only distances are stored: one contiguous row-major buffer, 64-byte
+ * aligned, each row padded to a whole number of cache lines (read in
+ * every TSP inner loop). Paths are not kept for the n² pairs; once a tour
+ * is chosen, materializeTourPaths() unpacks just its n legs.
  */
 class TspMatrix {
 public:
     /**
-     * @brief Matrix entry (distance + path)
+     * @brief Matrix entry, see getEntry()
      */
     struct Entry {
         double distance;
-        std::vector<int64_t> pathEdgeIds;
         
         Entry() : distance(0.0) {}
-        Entry(double dist, const std::vector<int64_t>& path)
-            : distance(dist), pathEdgeIds(path) {}
+        explicit Entry(double dist) : distance(dist) {}
     };
     
     /**
@@ -39,12 +43,22 @@ public:
      */
     using ProgressCallback = std::function<void(int current, int total, int percent)>;
     
+    /**
+     * @brief Called from the worker thread once row fromIdx holds its final distances
+     */
+    using RowCallback = std::function<void(size_t fromIdx)>;
+    
 private:
     size_t size_;
+    size_t stride_;                         // Row length in doubles (multiple of 8 = 64 bytes)
     std::vector<int64_t> nodeIds_;
+    IdIndexTable nodeIndex_;                // Node ID -> first index with that ID
+    
+    // distances_[fromIdx * stride_ + toIdx]
+    std::vector<double, AlignedAllocator<double>> distances_;
     
-    // Matriz: matrix_[fromIdx][toIdx] = Entry
-    std::vector<std::vector<Entry>> matrix_;
+    // Waypoint positions (empty = unknown), filled from the graph
+    std::vector<Coordinate> coordinates_;
     
 public:
     /**
@@ -62,38 +76,90 @@ public:
      * @param algorithm Pathfinding algorithm (Dijkstra, A*, etc.)
      * @param vehicleProfile Vehicle profile (can be nullptr)
      * @param progressCallback Callback for progress feedback (optional)
+     * @param rowCallback Callback per finished row, e.g. to use it before the rest (optional)
      */
     void precompute(
         const Graph& graph,
         IPathfindingAlgorithm* algorithm,
         const VehicleProfile* vehicleProfile = nullptr,
-        ProgressCallback progressCallback = nullptr
+        ProgressCallback progressCallback = nullptr,
+        RowCallback rowCallback = nullptr
     );
     
+    /**
+     * @brief Fill every pair with the straight-line (haversine) distance
+     * 
+     * Cheap lower-bound estimates of the road distances, to start solving
+     * while precompute() runs (see PipelinedTspSolver).
+     */
+    void estimateFromCoordinates(const Graph& graph);
+    
+    /**
+     * @brief Overwrite row fromIdx with the same row of source (same size)
+     */
+    void copyRow(const TspMatrix& source, size_t fromIdx);
+    
+    /**
+     * @brief Distance between two indices (hot path)
+     */
+    double getDistance(size_t fromIdx, size_t toIdx) const {
+        return distances_[fromIdx * stride_ + toIdx];
+    }
+    
+    /**
+     * @brief Distances from one index to every index (getSize() values)
+     */
+    const double* getRow(size_t fromIdx) const {
+        return &distances_[fromIdx * stride_];
+    }
+    
     /**
      * @brief Get matrix entry
      */
-    const Entry& getEntry(size_t fromIdx, size_t toIdx) const {
-        return matrix_[fromIdx][toIdx];
+    Entry getEntry(size_t fromIdx, size_t toIdx) const {
+        return Entry(getDistance(fromIdx, toIdx));
     }
     
     /**
      * @brief Get matrix entry by node IDs
      */
-    const Entry& getEntry(int64_t fromNodeId, int64_t toNodeId) const;
+    Entry getEntryByNodeIds(int64_t fromNodeId, int64_t toNodeId) const;
+    
+    /**
+     * @brief Edge paths of the tour legs, computed on demand
+     * 
+     * One point-to-point search per leg with the algorithm used for
+     * precompute, so each path matches its matrix distance.
+     * 
+     * @return One path per leg tour[i] -> tour[i + 1] (plus the closing leg if returnToStart)
+     */
+    std::vector<std::vector<int64_t>> materializeTourPaths(
+        const Graph& graph,
+        IPathfindingAlgorithm* algorithm,
+        const VehicleProfile* vehicleProfile,
+        const std::vector<int>& tour,
+        bool returnToStart
+    ) const;
+    
+    /**
+     * @brief Waypoint positions by index (empty if the matrix was not built from a graph)
+     */
+    const std::vector<Coordinate>& getCoordinates() const {
+        return coordinates_;
+    }
     
     /**
-     * @brief Get path of edges between two nodes
+     * @brief Manually set waypoint positions (for tests)
      */
-    const std::vector<int64_t>& getPath(size_t fromIdx, size_t toIdx) const {
-        return matrix_[fromIdx][toIdx].pathEdgeIds;
+    void setCoordinates(const std::vector<Coordinate>& coordinates) {
+        coordinates_ = coordinates;
     }
     
     /**
      * @brief Manually set distance (for tests)
      */
     void setDistance(size_t fromIdx, size_t toIdx, double distance) {
-        matrix_[fromIdx][toIdx].distance = distance;
+        distances_[fromIdx * stride_ + toIdx] = distance;
     }
     
     /**
@@ -104,7 +170,7 @@ public:
     }
     
     /**
-     * @brief Get index by node ID
+     * @brief Get index by node ID (hash lookup)
      */
     size_t getNodeIndex(int64_t nodeId) const;
     
@@ -128,6 +194,7 @@ public:
      * @brief Nearest Neighbor heuristic initialization
      * 
      * MAPPING: TspMatrix.nearestNeighborRoute() in Java
+     * (other constructions: TourConstruction.h)
      * 
      * @param startIdx Start index (0 to N-1)
      * @return Heuristic tour (indices)
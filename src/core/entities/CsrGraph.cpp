@@ -0,0 +1,131 @@
+#include "CsrGraph.h"
+#include "Graph.h"
+#include <unordered_map>
+#include <algorithm>
+#include <cstring>
+
+CsrGraph::CsrGraph(const Graph& graph)
+    : nodeIndex_(graph.getNodeIndexTable())
+{
+    const size_t nodeCount = graph.getIndexedNodeCount();
+    const size_t edgeCount = graph.getIndexedEdgeCount();
+
+    // FIRST: Node data in dense index order
+    nodeIds_.resize(nodeCount);
+    latitudes_.resize(nodeCount);
+    longitudes_.resize(nodeCount);
+
+    for (uint32_t i = 0; i < nodeCount; i++) {
+        Node* node = graph.getNodeByIndex(i);
+        nodeIds_[i] = node->getId();
+        latitudes_[i] = node->getCoordinate().getLatitude();
+        longitudes_[i] = node->getCoordinate().getLongitude();
+    }
+
+    // SECOND: Count arcs per source node
+    edgeIds_.resize(edgeCount);
+    std::vector<uint32_t> edgeSources(edgeCount);
+
+    offsets_.assign(nodeCount + 1, 0);
+    for (uint32_t e = 0; e < edgeCount; e++) {
+        Edge* edge = graph.getEdgeByIndex(e);
+        edgeIds_[e] = edge->getId();
+        edgeSources[e] = graph.getNodeIndex(edge->getSource()->getId());
+        offsets_[edgeSources[e] + 1]++;
+    }
+    for (size_t i = 0; i < nodeCount; i++) {
+        offsets_[i + 1] += offsets_[i];
+    }
+
+    // THIRD: Fill arc arrays (counting sort by source)
+    sources_.resize(edgeCount);
+    targets_.resize(edgeCount);
+    weights_.resize(edgeCount);
+    arcEdges_.resize(edgeCount);
+    roadClasses_.resize(edgeCount);
+
+    roadClassNames_.push_back("");
+    std::unordered_map<std::string, uint16_t> roadClassIndex;
+
+    std::vector<uint32_t> cursor(offsets_.begin(), offsets_.end() - 1);
+    for (uint32_t e = 0; e < edgeCount; e++) {
+        const Edge* edge = graph.getEdgeByIndex(e);
+        uint32_t source = edgeSources[e];
+        uint32_t arc = cursor[source]++;
+
+        sources_[arc] = source;
+        targets_[arc] = graph.getNodeIndex(edge->getTarget()->getId());
+        weights_[arc] = edge->getDistance().getMeters();
+        arcEdges_[arc] = e;
+
+        uint16_t roadClass = NO_ROAD_CLASS;
+        auto hwIt = edge->getTags().find("highway");
+        if (hwIt != edge->getTags().end()) {
+            auto [it, inserted] = roadClassIndex.emplace(
+                hwIt->second, static_cast<uint16_t>(roadClassNames_.size()));
+            if (inserted) {
+                roadClassNames_.push_back(hwIt->second);
+            }
+            roadClass = it->second;
+        }
+        roadClasses_[arc] = roadClass;
+    }
+
+    // FOURTH: Reverse index (arcs grouped by target)
+    inOffsets_.assign(nodeCount + 1, 0);
+    for (uint32_t arc = 0; arc < edgeCount; arc++) {
+        inOffsets_[targets_[arc] + 1]++;
+    }
+    for (size_t i = 0; i < nodeCount; i++) {
+        inOffsets_[i + 1] += inOffsets_[i];
+    }
+
+    inArcs_.resize(edgeCount);
+    std::vector<uint32_t> inCursor(inOffsets_.begin(), inOffsets_.end() - 1);
+    for (uint32_t arc = 0; arc < edgeCount; arc++) {
+        inArcs_[inCursor[targets_[arc]]++] = arc;
+    }
+}
+
+std::string CsrGraph::getRestrictionKey(const std::vector<char>& blockedClasses) const {
+    std::vector<std::string> blocked;
+    for (size_t i = 0; i < blockedClasses.size() && i < roadClassNames_.size(); i++) {
+        if (blockedClasses[i]) blocked.push_back(roadClassNames_[i]);
+    }
+    std::sort(blocked.begin(), blocked.end());
+
+    std::string key;
+    for (const auto& name : blocked) {
+        if (!key.empty()) key += ',';
+        key += name;
+    }
+    return key;
+}
+
+uint64_t CsrGraph::computeFingerprint() const {
+    // FNV-1a over 64-bit words
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    auto mix = [&hash](uint64_t word) {
+        hash ^= word;
+        hash *= 0x100000001b3ULL;
+    };
+
+    mix(getNodeCount());
+    mix(getArcCount());
+    for (size_t v = 0; v < nodeIds_.size(); v++) {
+        mix(static_cast<uint64_t>(nodeIds_[v]));
+        mix(offsets_[v + 1]);
+    }
+    for (size_t arc = 0; arc < targets_.size(); arc++) {
+        uint64_t bits;
+        std::memcpy(&bits, &weights_[arc], sizeof(bits));
+        mix(targets_[arc]);
+        mix(bits);
+        mix(roadClasses_[arc]);
+    }
+    for (const auto& name : roadClassNames_) {
+        for (char c : name) mix(static_cast<unsigned char>(c));
+        mix(0);
+    }
+    return hash;
+}
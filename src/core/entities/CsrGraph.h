@@ -0,0 +1,106 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "IdIndexTable.h"
+
+class Graph;
+
+/**
+ * @brief Frozen compressed sparse row (CSR) snapshot of a Graph
+ *
+ * Uses the dense indices assigned by the Graph (nodes [0, N), edges
+ * [0, M), both ordered by id) and stores the outgoing arcs of
+ * node i contiguously in [arcBegin(i), arcEnd(i)). Targets, weights,
+ * 32-bit edge indices and road classes live in parallel flat arrays, so
+ * the pathfinding inner loop never hashes, allocates or follows pointers.
+ *
+ * - A reverse index lists, per node, the arcs that end there (backward
+ *   searches walk it and read source/weight/class from the arc arrays).
+ * - Every Edge contributes exactly one arc source -> target. Two-way
+ *   streets are already stored as explicit reverse edges by the loaders.
+ * - Road class = index of the "highway" tag value in getRoadClasses()
+ *   (0 = no highway tag). Vehicle restrictions are resolved per query into
+ *   a small blocked-class table instead of string lookups per edge.
+ * - The snapshot is read-only and safe to share between threads.
+ */
+class CsrGraph {
+public:
+    static constexpr uint32_t INVALID_INDEX = IdIndexTable::NOT_FOUND;
+    static constexpr uint16_t NO_ROAD_CLASS = 0;
+
+private:
+    // Node data (indexed by dense node index)
+    std::vector<int64_t> nodeIds_;
+    std::vector<double> latitudes_;
+    std::vector<double> longitudes_;
+    IdIndexTable nodeIndex_;
+
+    // Edge data (indexed by dense edge index)
+    std::vector<int64_t> edgeIds_;
+
+    // Arc data (offsets_ has N + 1 entries)
+    std::vector<uint32_t> offsets_;
+    std::vector<uint32_t> sources_;
+    std::vector<uint32_t> targets_;
+    std::vector<double> weights_;
+    std::vector<uint32_t> arcEdges_;
+    std::vector<uint16_t> roadClasses_;
+
+    // Reverse index (inOffsets_ has N + 1 entries, inArcs_ holds arc ids)
+    std::vector<uint32_t> inOffsets_;
+    std::vector<uint32_t> inArcs_;
+
+    // Road class names ("" for class 0)
+    std::vector<std::string> roadClassNames_;
+
+public:
+    explicit CsrGraph(const Graph& graph);
+
+    // Sizes
+    size_t getNodeCount() const { return nodeIds_.size(); }
+    size_t getArcCount() const { return targets_.size(); }
+    size_t getEdgeCount() const { return edgeIds_.size(); }
+
+    // API boundary: OSM id <-> dense index
+    uint32_t getNodeIndex(int64_t nodeId) const { return nodeIndex_.find(nodeId); }
+    int64_t getNodeId(uint32_t nodeIdx) const { return nodeIds_[nodeIdx]; }
+    int64_t getEdgeId(uint32_t edgeIdx) const { return edgeIds_[edgeIdx]; }
+
+    // Node coordinates (for heuristics)
+    double getLatitude(uint32_t nodeIdx) const { return latitudes_[nodeIdx]; }
+    double getLongitude(uint32_t nodeIdx) const { return longitudes_[nodeIdx]; }
+
+    // Outgoing arcs of a node
+    uint32_t arcBegin(uint32_t nodeIdx) const { return offsets_[nodeIdx]; }
+    uint32_t arcEnd(uint32_t nodeIdx) const { return offsets_[nodeIdx + 1]; }
+
+    // Incoming arcs of a node: getInArc(i) for i in [inArcBegin, inArcEnd)
+    uint32_t inArcBegin(uint32_t nodeIdx) const { return inOffsets_[nodeIdx]; }
+    uint32_t inArcEnd(uint32_t nodeIdx) const { return inOffsets_[nodeIdx + 1]; }
+    uint32_t getInArc(uint32_t i) const { return inArcs_[i]; }
+
+    // Arc data
+    uint32_t getArcSource(uint32_t arc) const { return sources_[arc]; }
+    uint32_t getArcTarget(uint32_t arc) const { return targets_[arc]; }
+    double getArcWeight(uint32_t arc) const { return weights_[arc]; }
+    uint32_t getArcEdgeIndex(uint32_t arc) const { return arcEdges_[arc]; }
+    int64_t getArcEdgeId(uint32_t arc) const { return edgeIds_[arcEdges_[arc]]; }
+    uint16_t getArcRoadClass(uint32_t arc) const { return roadClasses_[arc]; }
+
+    // Road classes
+    const std::vector<std::string>& getRoadClasses() const { return roadClassNames_; }
+
+    /**
+     * @brief Identifies a set of blocked road classes ("" = no restrictions),
+     * used to key preprocessed data (landmarks, hierarchies) per profile
+     */
+    std::string getRestrictionKey(const std::vector<char>& blockedClasses) const;
+
+    /**
+     * @brief Hash of ids, topology, weights and road classes (O(arcs)), used
+     * to reject preprocessed data cached on disk for another graph
+     */
+    uint64_t computeFingerprint() const;
+};
@@ -33,6 +33,7 @@ public:
     Node* getSource() const { return source; }
     Node* getTarget() const { return target; }
     Distance& getDistance() { return distance; }
+    const Distance& getDistance() const { return distance; }
     bool IsOneWay() const { return isOneWay; }
     std::unordered_map<std::string, std::string>& getTags() { return tags; }
     const std::unordered_map<std::string, std::string>& getTags() const { return tags; }
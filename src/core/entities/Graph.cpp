@@ -1,4 +1,6 @@
 #include <vector>
+#include <algorithm>
+#include <stdexcept>
 #include "Graph.h"
 
 Graph::Graph() : minLatitude(0), maxLatitude(0), minLongitude(0), maxLongitude(0), boundsSet(false) {}
@@ -28,16 +30,48 @@ void Graph::addEdge(
     edges[id] = std::make_unique<Edge>(id, from, to, isOneWay, distance, tags);
 }
 
+void Graph::assignDenseIndices() {
+    if (nodes.size() >= IdIndexTable::NOT_FOUND || edges.size() >= IdIndexTable::NOT_FOUND) {
+        throw std::length_error("Graph too large for 32-bit dense indices");
+    }
+
+    indexedNodes = getNodes();
+    std::sort(indexedNodes.begin(), indexedNodes.end(), [](Node* a, Node* b) {
+        return a->getId() < b->getId();
+    });
+    indexedEdges = getEdges();
+    std::sort(indexedEdges.begin(), indexedEdges.end(), [](Edge* a, Edge* b) {
+        return a->getId() < b->getId();
+    });
+
+    nodeIndex.clear();
+    nodeIndex.reserve(indexedNodes.size());
+    for (uint32_t i = 0; i < indexedNodes.size(); i++) {
+        nodeIndex.insert(indexedNodes[i]->getId(), i);
+    }
+
+    edgeIndex.clear();
+    edgeIndex.reserve(indexedEdges.size());
+    for (uint32_t i = 0; i < indexedEdges.size(); i++) {
+        edgeIndex.insert(indexedEdges[i]->getId(), i);
+    }
+}
+
 void Graph::buildAdjacencyList() {
     adjacencyList.clear();
+    incomingList.clear();
+    assignDenseIndices();
     
     for (const auto& [id, edgePtr] : edges) {
         Edge* edge = edgePtr.get();
         adjacencyList[edge->getSource()->getId()].push_back(edge);
+        incomingList[edge->getTarget()->getId()].push_back(edge);
         if (!edge->IsOneWay()) {
             adjacencyList[edge->getTarget()->getId()].push_back(edge);
         }
     }
+
+    csrGraph = std::make_shared<const CsrGraph>(*this);
 }
 
 Node* Graph::getNode(int64_t id) const {
@@ -90,6 +124,11 @@ std::vector<Edge*> Graph::getOutgoingEdges(int64_t nodeId) const {
     return (it != adjacencyList.end()) ? it->second : std::vector<Edge*>{};
 }
 
+std::vector<Edge*> Graph::getIncomingEdges(int64_t nodeId) const {
+    auto it = incomingList.find(nodeId);
+    return (it != incomingList.end()) ? it->second : std::vector<Edge*>{};
+}
+
 std::vector<Node*> Graph::getNeighbors(int64_t nodeId) const {
     std::vector<Node*> neighbors;
     auto it = adjacencyList.find(nodeId);
@@ -136,5 +175,11 @@ void Graph::clear() {
     nodes.clear();
     edges.clear();
     adjacencyList.clear();
+    incomingList.clear();
+    nodeIndex.clear();
+    edgeIndex.clear();
+    indexedNodes.clear();
+    indexedEdges.clear();
+    csrGraph.reset();
     boundsSet = false;
 }
\ No newline at end of file
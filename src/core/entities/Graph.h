@@ -5,6 +5,8 @@
 #include <memory>
 #include "Node.h"
 #include "Edge.h"
+#include "CsrGraph.h"
+#include "IdIndexTable.h"
 
 class Graph {
 private:
@@ -14,6 +16,20 @@ private:
     // Adjacency list: node ID to list of outgoing edges
     std::unordered_map<int64_t, std::vector<Edge*>> adjacencyList;
 
+    // Reverse adjacency: node ID to list of incoming edges (edge target == node)
+    std::unordered_map<int64_t, std::vector<Edge*>> incomingList;
+
+    // Dense 32-bit indices (assigned by buildAdjacencyList, ordered by id)
+    IdIndexTable nodeIndex;
+    IdIndexTable edgeIndex;
+    std::vector<Node*> indexedNodes;
+    std::vector<Edge*> indexedEdges;
+
+    // Frozen CSR snapshot used by the routing algorithms (built with the adjacency list)
+    std::shared_ptr<const CsrGraph> csrGraph;
+
+    void assignDenseIndices();
+
     // Bounding box (limits of the graph)
     double minLatitude, maxLatitude, minLongitude, maxLongitude;
     bool boundsSet = false;
@@ -58,9 +74,22 @@ public:
 
     // Adyacencia
     std::vector<Edge*> getOutgoingEdges(int64_t nodeId) const;      // Useful for pathfinding
+    std::vector<Edge*> getIncomingEdges(int64_t nodeId) const;      // Useful for backward searches
     std::vector<Node*> getNeighbors(int64_t nodeId) const;
     bool hasDirectEdge(int64_t fromId, int64_t toId) const;
 
+    // Dense indices (INVALID if unknown or added after the last buildAdjacencyList)
+    uint32_t getNodeIndex(int64_t nodeId) const { return nodeIndex.find(nodeId); }
+    uint32_t getEdgeIndex(int64_t edgeId) const { return edgeIndex.find(edgeId); }
+    Node* getNodeByIndex(uint32_t index) const { return indexedNodes[index]; }
+    Edge* getEdgeByIndex(uint32_t index) const { return indexedEdges[index]; }
+    size_t getIndexedNodeCount() const { return indexedNodes.size(); }
+    size_t getIndexedEdgeCount() const { return indexedEdges.size(); }
+    const IdIndexTable& getNodeIndexTable() const { return nodeIndex; }
+
+    // CSR snapshot of the graph at the last buildAdjacencyList() (nullptr if never built)
+    std::shared_ptr<const CsrGraph> getCsrGraph() const { return csrGraph; }
+
     // Bounding box
     bool hasBoundSet() const { return boundsSet; }
     void setBounds(double minLat, double maxLat, double minLon, double maxLon);
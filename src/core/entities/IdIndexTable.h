@@ -0,0 +1,96 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Flat open-addressing table OSM id (int64) -> dense index (uint32)
+ *
+ * - Linear probing over a power-of-two capacity, load factor <= 0.5
+ * - Keys and values in two flat arrays (12 bytes per slot, no nodes/buckets)
+ * - Only used at the API boundary; algorithms work on the dense indices
+ */
+class IdIndexTable {
+public:
+    static constexpr uint32_t NOT_FOUND = 0xFFFFFFFFu;
+
+private:
+    std::vector<int64_t> keys_;
+    std::vector<uint32_t> values_;     // NOT_FOUND marks an empty slot
+    size_t mask_ = 0;
+    size_t size_ = 0;
+
+    static size_t hash(int64_t key) {
+        // 64-bit finalizer (MurmurHash3 fmix64): OSM ids are sequential-ish
+        uint64_t x = static_cast<uint64_t>(key);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return static_cast<size_t>(x);
+    }
+
+    void rehash(size_t capacity) {
+        std::vector<int64_t> oldKeys;
+        std::vector<uint32_t> oldValues;
+        oldKeys.swap(keys_);
+        oldValues.swap(values_);
+
+        keys_.assign(capacity, 0);
+        values_.assign(capacity, NOT_FOUND);
+        mask_ = capacity - 1;
+        size_ = 0;
+
+        for (size_t i = 0; i < oldValues.size(); i++) {
+            if (oldValues[i] != NOT_FOUND) {
+                insert(oldKeys[i], oldValues[i]);
+            }
+        }
+    }
+
+public:
+    void reserve(size_t count) {
+        size_t capacity = 16;
+        while (capacity < count * 2) capacity <<= 1;
+        if (capacity > values_.size()) rehash(capacity);
+    }
+
+    // Insert or overwrite
+    void insert(int64_t key, uint32_t value) {
+        if ((size_ + 1) * 2 > values_.size()) {
+            rehash(values_.empty() ? 16 : values_.size() * 2);
+        }
+        size_t slot = hash(key) & mask_;
+        while (values_[slot] != NOT_FOUND) {
+            if (keys_[slot] == key) {
+                values_[slot] = value;
+                return;
+            }
+            slot = (slot + 1) & mask_;
+        }
+        keys_[slot] = key;
+        values_[slot] = value;
+        size_++;
+    }
+
+    uint32_t find(int64_t key) const {
+        if (size_ == 0) return NOT_FOUND;
+        size_t slot = hash(key) & mask_;
+        while (values_[slot] != NOT_FOUND) {
+            if (keys_[slot] == key) return values_[slot];
+            slot = (slot + 1) & mask_;
+        }
+        return NOT_FOUND;
+    }
+
+    size_t size() const { return size_; }
+
+    void clear() {
+        keys_.clear();
+        values_.clear();
+        mask_ = 0;
+        size_ = 0;
+    }
+};
@@ -6,6 +6,7 @@
 
 class Graph;
 class VehicleProfile;
+class SearchWorkspace;
 
 /*
  * - Polymorphism: Abstract main class with pure virtual methods
@@ -30,7 +31,50 @@ public:
         int64_t endNodeId,
         const VehicleProfile* vehicleProfile
     ) = 0;
-    
+
+    // Same search reusing caller-owned search state (one workspace per thread).
+    // Algorithms without reusable state simply ignore the workspace.
+    virtual std::vector<int64_t> findPath(
+        const Graph& graph,
+        int64_t startNodeId,
+        int64_t endNodeId,
+        const VehicleProfile* vehicleProfile,
+        SearchWorkspace& /*workspace*/
+    ) {
+        return findPath(graph, startNodeId, endNodeId, vehicleProfile);
+    }
+
+    // Paths from startNodeId to every target (one per target, empty = no route).
+    // Algorithms with a one-to-many mode answer all targets with a single search;
+    // the default runs one point-to-point search per target.
+    virtual std::vector<std::vector<int64_t>> findPathsToMany(
+        const Graph& graph,
+        int64_t startNodeId,
+        const std::vector<int64_t>& targetNodeIds,
+        const VehicleProfile* vehicleProfile,
+        SearchWorkspace& workspace
+    ) {
+        std::vector<std::vector<int64_t>> paths;
+        paths.reserve(targetNodeIds.size());
+        for (int64_t targetNodeId : targetNodeIds) {
+            paths.push_back(findPath(graph, startNodeId, targetNodeId, vehicleProfile, workspace));
+        }
+        return paths;
+    }
+
+    // Distances only (one per target, infinity = no route), without building paths.
+    // Returns false if the algorithm has no such mode: callers use findPathsToMany.
+    virtual bool findDistancesToMany(
+        const Graph& /*graph*/,
+        int64_t /*startNodeId*/,
+        const std::vector<int64_t>& /*targetNodeIds*/,
+        const VehicleProfile* /*vehicleProfile*/,
+        SearchWorkspace& /*workspace*/,
+        std::vector<double>& /*distances*/
+    ) {
+        return false;
+    }
+
     // Name of the algorithm (for logging/debugging)
     virtual std::string getName() const = 0;
 
@@ -3,9 +3,23 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <random>
 
 class TspMatrix;
 
+/**
+ * @brief Starting tour built by solve() when no initial tour is given
+ */
+enum class TourConstruction {
+    NEAREST_NEIGHBOR,       // Greedy walk from index 0, O(n²)
+    GREEDY_EDGE,            // Cheapest edges first, no city of degree 3, no subtour
+    CHRISTOFIDES,           // MST + greedy matching of odd vertices, Euler walk shortcut
+    SPACE_FILLING_CURVE     // Hilbert order of the waypoint coordinates, O(n log n), no distances read
+};
+
 /*
  * - Polymorphism: Abstract main class with pure virtual methods
  * - Low coupling: Concrete algorithms depend only on this interface
@@ -13,6 +27,14 @@ class TspMatrix;
 
 class ITspAlgorithm {
 public:
+    /**
+     * @brief Receives each improved incumbent: tour, its cost and ms since solve() began
+     *
+     * Called synchronously from the solving thread(s) and must be cheap and
+     * thread-safe (multi-threaded solvers serialise their own calls).
+     */
+    using ImprovementCallback = std::function<void(const std::vector<int>& tour, double cost, double elapsedMs)>;
+
     virtual ~ITspAlgorithm() = default;
 
     /**
@@ -29,5 +51,119 @@ public:
     virtual std::string getName() const = 0;
 
     virtual void setMaxIterations(int maxIterations) {}
-    virtual void setTimeLimit(double seconds) {}
+    virtual void setReturnToStart(bool /*value*/) {}
+
+    /**
+     * @brief Wall-clock budget of each solve(): stops at the first iteration
+     *        boundary past it, or after maxIterations, whichever comes first
+     * @param seconds Budget (0 = iteration count only)
+     */
+    virtual void setTimeLimit(double seconds) {
+        timeLimitSeconds_ = seconds;
+    }
+
+    /**
+     * @brief Seed the random generator (default: std::random_device)
+     *
+     * Same seed, matrix and iteration count give the same tour; a time
+     * limit may cut the run at a different iteration.
+     */
+    virtual void setSeed(uint64_t seed) {
+        seed_ = seed;
+    }
+
+    /**
+     * @brief Publish every new best tour while solve() runs (empty = none)
+     */
+    virtual void setImprovementCallback(ImprovementCallback callback) {
+        improvementCallback_ = std::move(callback);
+    }
+
+    /**
+     * @brief Start the next solve() from this tour instead of building one
+     * @param tour Permutation of 0..N-1 starting with 0 (empty = default construction)
+     */
+    virtual void setInitialTour(const std::vector<int>& tour) {
+        initialTour_ = tour;
+    }
+
+    /**
+     * @brief Heuristic for the starting tour when setInitialTour() was not used
+     */
+    virtual void setConstruction(TourConstruction construction) {
+        construction_ = construction;
+    }
+
+    /**
+     * @brief Stop as soon as the best tour is within gap of a lower bound
+     * @param lowerBound Lower bound of the optimal cost (e.g. OneTreeBound)
+     * @param gap Relative gap, e.g. 0.01 = at most 1% above the bound (0 = never stop early)
+     */
+    virtual void setTargetGap(double lowerBound, double gap) {
+        lowerBound_ = lowerBound;
+        targetGap_ = gap;
+    }
+
+protected:
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<int> initialTour_;
+    TourConstruction construction_ = TourConstruction::NEAREST_NEIGHBOR;
+    double lowerBound_ = 0.0;
+    double targetGap_ = 0.0;
+    double timeLimitSeconds_ = 0.0;
+    std::optional<uint64_t> seed_;
+    ImprovementCallback improvementCallback_;
+    Clock::time_point solveStart_;
+
+    /**
+     * @brief Mark the start of a solve() and return its deadline (Clock::time_point::max() = none)
+     */
+    Clock::time_point beginSolve() {
+        solveStart_ = Clock::now();
+        if (timeLimitSeconds_ <= 0.0) {
+            return Clock::time_point::max();
+        }
+        return solveStart_ + std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(timeLimitSeconds_));
+    }
+
+    /**
+     * @brief Hand a new best tour to the improvement callback, if any
+     */
+    void reportImprovement(const std::vector<int>& tour, double cost) const {
+        if (improvementCallback_) {
+            improvementCallback_(tour, cost,
+                std::chrono::duration<double, std::milli>(Clock::now() - solveStart_).count());
+        }
+    }
+
+    /**
+     * @brief Whether deadline has passed (one clock read, cheap enough for every iteration)
+     */
+    static bool timeUp(Clock::time_point deadline) {
+        return deadline != Clock::time_point::max() && Clock::now() >= deadline;
+    }
+
+    /**
+     * @brief Whether cost is within the target gap of the lower bound (see setTargetGap)
+     */
+    bool gapReached(double cost) const {
+        return targetGap_ > 0.0 && lowerBound_ > 0.0 && cost <= lowerBound_ * (1.0 + targetGap_);
+    }
+
+    /**
+     * @brief Tour a solve() starts from: the setInitialTour() one if it fits
+     *        the matrix, else the setConstruction() heuristic
+     *
+     * Defined in TourConstruction.cpp.
+     */
+    std::vector<int> startingTour(const TspMatrix& matrix, bool returnToStart) const;
+
+    /**
+     * @brief Generator for one solve(): the explicit seed, else std::random_device
+     */
+    std::mt19937 makeRng() const {
+        return std::mt19937(seed_ ? static_cast<std::mt19937::result_type>(*seed_) : std::random_device{}());
+    }
 };
\ No newline at end of file
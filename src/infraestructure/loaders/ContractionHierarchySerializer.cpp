@@ -0,0 +1,140 @@
+#include "ContractionHierarchySerializer.h"
+#include <QFile>
+#include <QDataStream>
+#include <QDir>
+#include <QFileInfo>
+#include <QDebug>
+#include <stdexcept>
+
+namespace services {
+namespace io {
+
+void ContractionHierarchySerializer::serialize(
+    const std::vector<std::shared_ptr<const ContractionHierarchy>>& hierarchies,
+    const QString& filePath
+) {
+    // Create directory if it doesn't exist
+    QDir dir = QFileInfo(filePath).absoluteDir();
+    if (!dir.exists()) {
+        dir.mkpath(".");
+    }
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        throw std::runtime_error("Could not open file for writing: " + filePath.toStdString());
+    }
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    stream.writeRawData("OGRCHIER", 8);
+    stream << VERSION;
+    stream << static_cast<int32_t>(hierarchies.size());
+
+    for (const auto& ch : hierarchies) {
+        const std::string& key = ch->getRestrictionKey();
+        stream << static_cast<int32_t>(key.size());
+        stream.writeRawData(key.data(), static_cast<int>(key.size()));
+
+        stream << static_cast<quint64>(ch->getFingerprint());
+        stream << static_cast<int64_t>(ch->getNodeCount());
+        for (uint32_t rank : ch->getRanks()) {
+            stream << rank;
+        }
+
+        stream << static_cast<int64_t>(ch->getEdgeCount());
+        for (uint32_t e = 0; e < ch->getEdgeCount(); ++e) {
+            stream << ch->getEdgeFrom(e) << ch->getEdgeTo(e) << ch->getEdgeWeight(e)
+                   << ch->getEdgeArc(e) << ch->getEdgeFirst(e) << ch->getEdgeSecond(e)
+                   << static_cast<qint8>(ch->isEdgeActive(e) ? 1 : 0);
+        }
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        throw std::runtime_error("Error writing hierarchy file: " + filePath.toStdString());
+    }
+
+    qDebug() << "Contraction hierarchies saved:" << filePath << "(" << hierarchies.size() << "profiles)";
+}
+
+std::vector<std::shared_ptr<const ContractionHierarchy>> ContractionHierarchySerializer::load(const QString& filePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw std::runtime_error("Could not open hierarchy file: " + filePath.toStdString());
+    }
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    char magic[8];
+    stream.readRawData(magic, 8);
+    if (std::string(magic, 8) != "OGRCHIER") {
+        throw std::runtime_error("Invalid hierarchy file (bad magic): " + filePath.toStdString());
+    }
+
+    int32_t version, count;
+    stream >> version >> count;
+    if (version != VERSION) {
+        throw std::runtime_error("Unsupported hierarchy file version: " + filePath.toStdString());
+    }
+
+    std::vector<std::shared_ptr<const ContractionHierarchy>> hierarchies;
+
+    for (int32_t h = 0; h < count; ++h) {
+        int32_t keyLength;
+        stream >> keyLength;
+        std::string key(keyLength, '\0');
+        stream.readRawData(key.data(), keyLength);
+
+        quint64 fingerprint;
+        int64_t nodeCount;
+        stream >> fingerprint >> nodeCount;
+        if (nodeCount < 0 || stream.status() != QDataStream::Ok) {
+            throw std::runtime_error("Corrupt hierarchy file: " + filePath.toStdString());
+        }
+
+        std::vector<uint32_t> rank(nodeCount);
+        for (auto& r : rank) {
+            stream >> r;
+        }
+
+        int64_t edgeCount;
+        stream >> edgeCount;
+        if (edgeCount < 0 || stream.status() != QDataStream::Ok) {
+            throw std::runtime_error("Corrupt hierarchy file: " + filePath.toStdString());
+        }
+
+        std::vector<uint32_t> from(edgeCount), to(edgeCount), arc(edgeCount), first(edgeCount), second(edgeCount);
+        std::vector<double> weight(edgeCount);
+        std::vector<char> active(edgeCount);
+        for (int64_t e = 0; e < edgeCount; ++e) {
+            qint8 activeByte;
+            stream >> from[e] >> to[e] >> weight[e] >> arc[e] >> first[e] >> second[e] >> activeByte;
+            active[e] = (activeByte != 0);
+        }
+
+        if (stream.status() != QDataStream::Ok) {
+            throw std::runtime_error("Truncated hierarchy file: " + filePath.toStdString());
+        }
+
+        // Indices must stay inside the pool before building the query adjacency
+        for (int64_t e = 0; e < edgeCount; ++e) {
+            bool shortcut = (arc[e] == ContractionHierarchy::NO_EDGE);
+            if (from[e] >= rank.size() || to[e] >= rank.size() ||
+                (shortcut && (first[e] >= edgeCount || second[e] >= edgeCount))) {
+                throw std::runtime_error("Corrupt hierarchy file: " + filePath.toStdString());
+            }
+        }
+
+        hierarchies.push_back(std::make_shared<const ContractionHierarchy>(
+            key, fingerprint, std::move(rank),
+            std::move(from), std::move(to), std::move(weight),
+            std::move(arc), std::move(first), std::move(second), std::move(active)
+        ));
+    }
+
+    return hierarchies;
+}
+
+}
+}
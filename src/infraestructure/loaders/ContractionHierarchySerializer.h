@@ -0,0 +1,36 @@
+#pragma once
+
+#include <QString>
+#include <memory>
+#include <vector>
+#include "../../algorithms/pathfinding/ContractionHierarchy.h"
+
+namespace services {
+namespace io {
+
+/**
+ * @brief Reads/writes Contraction Hierarchies next to the .bin graph cache
+ *
+ * File layout (little endian):
+ * - magic "OGRCHIER", int32 version, int32 hierarchy count
+ * - per hierarchy: restriction key (int32 length + UTF-8), uint64 fingerprint,
+ *   int64 node count, node ranks (uint32), int64 edge count, then per edge:
+ *   from, to (uint32), weight (double), arc, first, second (uint32), active (int8)
+ * The query adjacency is rebuilt from the edge pool on load.
+ */
+class ContractionHierarchySerializer {
+public:
+    static constexpr int32_t VERSION = 1;
+
+    // Save every hierarchy in one file
+    static void serialize(
+        const std::vector<std::shared_ptr<const ContractionHierarchy>>& hierarchies,
+        const QString& filePath
+    );
+
+    // Load all hierarchies (throws on missing or corrupt file)
+    static std::vector<std::shared_ptr<const ContractionHierarchy>> load(const QString& filePath);
+};
+
+}
+}
@@ -0,0 +1,128 @@
+#include "LandmarkSerializer.h"
+#include <QFile>
+#include <QDataStream>
+#include <QDir>
+#include <QFileInfo>
+#include <QDebug>
+#include <stdexcept>
+
+namespace services {
+namespace io {
+
+void LandmarkSerializer::serialize(
+    const std::vector<std::shared_ptr<const LandmarkTable>>& tables,
+    const QString& filePath
+) {
+    // Create directory if it doesn't exist
+    QDir dir = QFileInfo(filePath).absoluteDir();
+    if (!dir.exists()) {
+        dir.mkpath(".");
+    }
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        throw std::runtime_error("Could not open file for writing: " + filePath.toStdString());
+    }
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    stream.writeRawData("OGRLMARK", 8);
+    stream << VERSION;
+    stream << static_cast<int32_t>(tables.size());
+
+    for (const auto& table : tables) {
+        const std::string& key = table->getRestrictionKey();
+        stream << static_cast<int32_t>(key.size());
+        stream.writeRawData(key.data(), static_cast<int>(key.size()));
+
+        stream << static_cast<quint64>(table->getFingerprint());
+        stream << static_cast<int64_t>(table->getNodeCount());
+        stream << static_cast<int32_t>(table->getLandmarkCount());
+
+        for (uint32_t landmark : table->getLandmarks()) {
+            stream << landmark;
+        }
+        for (double distance : table->getFromLandmark()) {
+            stream << distance;
+        }
+        for (double distance : table->getToLandmark()) {
+            stream << distance;
+        }
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        throw std::runtime_error("Error writing landmark file: " + filePath.toStdString());
+    }
+
+    qDebug() << "Landmarks saved:" << filePath << "(" << tables.size() << "tables)";
+}
+
+std::vector<std::shared_ptr<const LandmarkTable>> LandmarkSerializer::load(const QString& filePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw std::runtime_error("Could not open landmark file: " + filePath.toStdString());
+    }
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    char magic[8];
+    stream.readRawData(magic, 8);
+    if (std::string(magic, 8) != "OGRLMARK") {
+        throw std::runtime_error("Invalid landmark file (bad magic): " + filePath.toStdString());
+    }
+
+    int32_t version, tableCount;
+    stream >> version >> tableCount;
+    if (version != VERSION) {
+        throw std::runtime_error("Unsupported landmark file version: " + filePath.toStdString());
+    }
+
+    std::vector<std::shared_ptr<const LandmarkTable>> tables;
+
+    for (int32_t t = 0; t < tableCount; ++t) {
+        int32_t keyLength;
+        stream >> keyLength;
+        std::string key(keyLength, '\0');
+        stream.readRawData(key.data(), keyLength);
+
+        quint64 fingerprint;
+        int64_t nodeCount;
+        int32_t landmarkCount;
+        stream >> fingerprint >> nodeCount >> landmarkCount;
+
+        if (nodeCount < 0 || landmarkCount < 0 || stream.status() != QDataStream::Ok) {
+            throw std::runtime_error("Corrupt landmark file: " + filePath.toStdString());
+        }
+
+        std::vector<uint32_t> landmarks(landmarkCount);
+        for (auto& landmark : landmarks) {
+            stream >> landmark;
+        }
+
+        const size_t entries = static_cast<size_t>(nodeCount) * landmarkCount;
+        std::vector<double> fromLandmark(entries);
+        std::vector<double> toLandmark(entries);
+        for (auto& distance : fromLandmark) {
+            stream >> distance;
+        }
+        for (auto& distance : toLandmark) {
+            stream >> distance;
+        }
+
+        if (stream.status() != QDataStream::Ok) {
+            throw std::runtime_error("Truncated landmark file: " + filePath.toStdString());
+        }
+
+        tables.push_back(std::make_shared<const LandmarkTable>(
+            key, fingerprint, static_cast<size_t>(nodeCount),
+            std::move(landmarks), std::move(fromLandmark), std::move(toLandmark)
+        ));
+    }
+
+    return tables;
+}
+
+}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <QString>
+#include <memory>
+#include <vector>
+#include "../../algorithms/pathfinding/LandmarkTable.h"
+
+namespace services {
+namespace io {
+
+/**
+ * @brief Reads/writes ALT landmark tables next to the .bin graph cache
+ *
+ * File layout (little endian):
+ * - magic "OGRLMARK", int32 version, int32 table count
+ * - per table: restriction key (int32 length + UTF-8), uint64 fingerprint,
+ *   int64 node count, int32 landmark count, landmark indices (uint32),
+ *   then fromLandmark and toLandmark (node-major doubles)
+ */
+class LandmarkSerializer {
+public:
+    static constexpr int32_t VERSION = 1;
+
+    // Save every table in one file
+    static void serialize(
+        const std::vector<std::shared_ptr<const LandmarkTable>>& tables,
+        const QString& filePath
+    );
+
+    // Load all tables (throws on missing or corrupt file)
+    static std::vector<std::shared_ptr<const LandmarkTable>> load(const QString& filePath);
+};
+
+}
+}
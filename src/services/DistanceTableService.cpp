@@ -0,0 +1,134 @@
+#include "DistanceTableService.h"
+#include "../algorithms/pathfinding/ManyToManyTable.h"
+#include "../algorithms/pathfinding/ContractionHierarchyAlgorithm.h"
+#include "../utils/exceptions/GraphException.h"
+#include <QtConcurrent/QtConcurrent>
+#include <thread>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <iostream>
+
+DistanceTableService::DistanceTableService(QObject* parent)
+    : QObject(parent)
+    , graph_(nullptr)
+    , hierarchyStore_(std::make_shared<ContractionHierarchyStore>())
+{}
+
+DistanceTableService::DistanceTable DistanceTableService::computeTableSync(
+    const std::vector<int64_t>& sourceIds,
+    const std::vector<int64_t>& targetIds,
+    const VehicleProfile* vehicleProfile
+) {
+    if (!graph_) {
+        throw GraphException("Graph not loaded");
+    }
+    for (const auto* ids : {&sourceIds, &targetIds}) {
+        for (int64_t nodeId : *ids) {
+            if (!graph_->hasNode(nodeId)) {
+                throw NodeNotFoundException(nodeId);
+            }
+        }
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    DistanceTable table;
+    table.sourceIds = sourceIds;
+    table.targetIds = targetIds;
+    table.distances.assign(sourceIds.size() * targetIds.size(), std::numeric_limits<float>::infinity());
+
+    auto csr = graph_->getCsrGraph();
+    if (!csr || table.distances.empty()) {
+        return table; // Adjacency not built = everything unreachable
+    }
+
+    std::vector<char> blockedClasses;
+    if (vehicleProfile != nullptr) {
+        blockedClasses = vehicleProfile->getBlockedRoadClasses(csr->getRoadClasses());
+    }
+    auto ch = hierarchyStore_->getOrBuild(csr, blockedClasses);
+
+    // Nodes added after the snapshot map to INVALID_INDEX (row/column stays infinite)
+    std::vector<uint32_t> sources;
+    std::vector<uint32_t> targets;
+    for (int64_t nodeId : sourceIds) sources.push_back(csr->getNodeIndex(nodeId));
+    for (int64_t nodeId : targetIds) targets.push_back(csr->getNodeIndex(nodeId));
+
+    // 1. Backward searches fill the buckets
+    std::unique_ptr<ManyToManyTable> buckets;
+    {
+        auto workspace = workspacePool_.acquire();
+        buckets = std::make_unique<ManyToManyTable>(*ch, targets, *workspace);
+    }
+
+    // 2. Forward searches, one row each, spread over worker threads
+    unsigned int numThreads = std::min(
+        std::max(1u, std::thread::hardware_concurrency()),
+        static_cast<unsigned int>(sources.size())
+    );
+    std::atomic<size_t> nextRow{0};
+    auto workerFunction = [&]() {
+        auto workspace = workspacePool_.acquire();
+        while (true) {
+            size_t row = nextRow.fetch_add(1);
+            if (row >= sources.size()) break;
+            buckets->computeRow(sources[row], &table.distances[row * targets.size()], *workspace);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 1; t < numThreads; t++) {
+        threads.emplace_back(workerFunction);
+    }
+    workerFunction();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    table.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    std::cout << "   Distance table " << sourceIds.size() << "x" << targetIds.size()
+              << ": " << table.executionTimeMs << " ms (" << buckets->getBucketEntryCount()
+              << " bucket entries, " << numThreads << " threads)" << std::endl;
+
+    return table;
+}
+
+void DistanceTableService::computeTableAsync(
+    const std::vector<int64_t>& sourceIds,
+    const std::vector<int64_t>& targetIds,
+    const VehicleProfile* vehicleProfile
+) {
+    // Copiar VehicleProfile si existe (para evitar use-after-free en thread asíncrono)
+    std::unique_ptr<VehicleProfile> vehicleProfileCopy = nullptr;
+    if (vehicleProfile) {
+        vehicleProfileCopy = std::make_unique<VehicleProfile>(*vehicleProfile);
+    }
+
+    tableFuture_ = QtConcurrent::run([this, sourceIds, targetIds,
+                                      vehicleProfileCopy = std::move(vehicleProfileCopy)]() {
+        try {
+            DistanceTable table = computeTableSync(sourceIds, targetIds, vehicleProfileCopy.get());
+            emit tableComputed(table);
+        } catch (const std::exception& e) {
+            emit tableError(QString::fromStdString(e.what()));
+        }
+    });
+}
+
+std::vector<int64_t> DistanceTableService::findPath(
+    int64_t sourceId,
+    int64_t targetId,
+    const VehicleProfile* vehicleProfile
+) {
+    if (!graph_) {
+        throw GraphException("Graph not loaded");
+    }
+
+    ContractionHierarchyAlgorithm algorithm(hierarchyStore_);
+    auto workspace = workspacePool_.acquire();
+    return algorithm.findPath(*graph_, sourceId, targetId, vehicleProfile, *workspace);
+}
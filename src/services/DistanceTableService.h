@@ -0,0 +1,94 @@
+#pragma once
+
+#include <QObject>
+#include <QFuture>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include "../core/entities/Graph.h"
+#include "../algorithms/VehicleProfile.h"
+#include "../algorithms/pathfinding/SearchWorkspace.h"
+#include "../algorithms/pathfinding/ContractionHierarchy.h"
+
+/**
+ * @brief Service for rectangular source x target distance tables
+ *
+ * For assignment/dispatch, where only the distances are needed:
+ * - Bucket-based many-to-many over the Contraction Hierarchy of the
+ *   vehicle profile (S + T upward searches instead of S x T queries)
+ * - Rows computed in parallel, result is a flat row-major float matrix
+ * - Paths are NOT built; findPath() materializes one pair on request
+ */
+class DistanceTableService : public QObject {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Distance table result
+     */
+    struct DistanceTable {
+        std::vector<int64_t> sourceIds;
+        std::vector<int64_t> targetIds;
+        std::vector<float> distances;       // [i * targetIds.size() + j] meters, infinity = unreachable
+        double executionTimeMs;
+
+        DistanceTable() : executionTimeMs(0.0) {}
+
+        float getDistance(size_t sourceIdx, size_t targetIdx) const {
+            return distances[sourceIdx * targetIds.size() + targetIdx];
+        }
+    };
+
+private:
+    std::shared_ptr<Graph> graph_;
+    QFuture<void> tableFuture_;
+
+    // Search state reused across tables and path requests
+    SearchWorkspacePool workspacePool_;
+
+    // Hierarchies per vehicle profile (shared with GraphService)
+    std::shared_ptr<ContractionHierarchyStore> hierarchyStore_;
+
+public:
+    explicit DistanceTableService(QObject* parent = nullptr);
+
+    void setGraph(std::shared_ptr<Graph> graph) {
+        graph_ = graph;
+        workspacePool_.clear();
+    }
+
+    void setHierarchyStore(std::shared_ptr<ContractionHierarchyStore> store) {
+        hierarchyStore_ = store;
+    }
+
+    /**
+     * @brief Computes the sources x targets table (SYNC)
+     */
+    DistanceTable computeTableSync(
+        const std::vector<int64_t>& sourceIds,
+        const std::vector<int64_t>& targetIds,
+        const VehicleProfile* vehicleProfile = nullptr
+    );
+
+    /**
+     * @brief Computes the table (ASYNC - does NOT freeze UI), emits tableComputed()
+     */
+    void computeTableAsync(
+        const std::vector<int64_t>& sourceIds,
+        const std::vector<int64_t>& targetIds,
+        const VehicleProfile* vehicleProfile = nullptr
+    );
+
+    /**
+     * @brief Edge path of one table entry (CH point-to-point query)
+     */
+    std::vector<int64_t> findPath(
+        int64_t sourceId,
+        int64_t targetId,
+        const VehicleProfile* vehicleProfile = nullptr
+    );
+
+signals:
+    void tableComputed(DistanceTable table);
+    void tableError(QString errorMessage);
+};
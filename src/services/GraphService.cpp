@@ -2,6 +2,9 @@
 #include "../infraestructure/loaders/OSMGraphLoader.h"
 #include "../infraestructure/loaders/BinaryGraphLoader.h"
 #include "../infraestructure/loaders/BinaryGraphSerializer.h"
+#include "../infraestructure/loaders/LandmarkSerializer.h"
+#include "../infraestructure/loaders/ContractionHierarchySerializer.h"
+#include "../algorithms/factories/VehicleProfileFactory.h"
 #include <QFile>
 #include <QFileInfo>
 #include <QElapsedTimer>
@@ -12,7 +15,9 @@
 namespace services {
 
 GraphService::GraphService(QObject* parent)
-    : QObject(parent) {
+    : QObject(parent)
+    , landmarkStore(std::make_shared<LandmarkStore>())
+    , hierarchyStore(std::make_shared<ContractionHierarchyStore>()) {
 }
 
 GraphService::~GraphService() {
@@ -61,6 +66,8 @@ void GraphService::loadGraphInternal(const QString& baseName) {
             }
 
             graph = loadedGraph;    
+            prepareLandmarks(baseName);
+            prepareContractionHierarchies(baseName);
             qint64 loadTime = timer.elapsed();
             
             // Debug messages
@@ -113,6 +120,8 @@ void GraphService::loadGraphInternal(const QString& baseName) {
         }
 
         graph = loadedGraph;
+        prepareLandmarks(baseName);
+        prepareContractionHierarchies(baseName);
         qint64 loadTime = timer.elapsed();
 
         qDebug() << "Graph loaded from .osm in" << loadTime << "ms";
@@ -128,4 +137,97 @@ void GraphService::loadGraphInternal(const QString& baseName) {
     }
 }
 
+std::vector<std::vector<char>> GraphService::getProfileRestrictions(const CsrGraph& csr) {
+    std::vector<std::vector<char>> restrictions = {{}};
+    for (const auto& name : VehicleProfileFactory::getAvailableProfiles()) {
+        auto profile = VehicleProfileFactory::getProfile(name);
+        restrictions.push_back(profile->getBlockedRoadClasses(csr.getRoadClasses()));
+    }
+    return restrictions;
+}
+
+void GraphService::prepareLandmarks(const QString& baseName) {
+    auto csr = graph->getCsrGraph();
+    if (!csr) {
+        return;
+    }
+
+    QString landmarkPath = QString("data/graphs/%1.landmarks").arg(baseName);
+    size_t loaded = 0;
+
+    if (fileExists(landmarkPath)) {
+        try {
+            for (auto& table : io::LandmarkSerializer::load(landmarkPath)) {
+                if (landmarkStore->add(csr, table)) loaded++;
+            }
+            qDebug() << "Landmark tables loaded:" << loaded;
+        } catch (const std::exception& ex) {
+            qWarning() << "Could not read landmarks:" << ex.what();
+        }
+    }
+
+    auto restrictions = getProfileRestrictions(*csr);
+
+    emit loadProgress("Preparing ALT landmarks (built only the first time)...", 0.9);
+
+    size_t built = 0;
+    for (const auto& blockedClasses : restrictions) {
+        if (cancelRequested) return;
+
+        size_t before = landmarkStore->getTables().size();
+        landmarkStore->getOrBuild(csr, blockedClasses);    // No-op if loaded from disk
+        if (landmarkStore->getTables().size() > before) built++;
+    }
+
+    if (built > 0) {
+        try {
+            io::LandmarkSerializer::serialize(landmarkStore->getTables(), landmarkPath);
+        } catch (const std::exception& ex) {
+            qWarning() << "Could not save landmarks:" << ex.what();
+            qWarning() << "(Not critical, they will be rebuilt next time)";
+        }
+    }
+}
+
+void GraphService::prepareContractionHierarchies(const QString& baseName) {
+    auto csr = graph->getCsrGraph();
+    if (!csr) {
+        return;
+    }
+
+    QString chPath = QString("data/graphs/%1.ch").arg(baseName);
+
+    if (fileExists(chPath)) {
+        try {
+            size_t loaded = 0;
+            for (auto& hierarchy : io::ContractionHierarchySerializer::load(chPath)) {
+                if (hierarchyStore->add(csr, hierarchy)) loaded++;
+            }
+            qDebug() << "Contraction hierarchies loaded:" << loaded;
+        } catch (const std::exception& ex) {
+            qWarning() << "Could not read contraction hierarchies:" << ex.what();
+        }
+    }
+
+    emit loadProgress("Preparing Contraction Hierarchies (built only the first time)...", 0.95);
+
+    size_t built = 0;
+    for (const auto& blockedClasses : getProfileRestrictions(*csr)) {
+        if (cancelRequested) return;
+
+        size_t before = hierarchyStore->getHierarchies().size();
+        hierarchyStore->getOrBuild(csr, blockedClasses);    // No-op if loaded from disk
+        if (hierarchyStore->getHierarchies().size() > before) built++;
+    }
+
+    if (built > 0) {
+        try {
+            io::ContractionHierarchySerializer::serialize(hierarchyStore->getHierarchies(), chPath);
+        } catch (const std::exception& ex) {
+            qWarning() << "Could not save contraction hierarchies:" << ex.what();
+            qWarning() << "(Not critical, they will be rebuilt next time)";
+        }
+    }
+}
+
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../core/entities/Graph.h"
+#include "../algorithms/pathfinding/LandmarkTable.h"
+#include "../algorithms/pathfinding/ContractionHierarchy.h"
 #include <QObject>
 #include <QString>
 #include <QFuture>
@@ -14,12 +16,18 @@ namespace services {
  * 1. Try to load .bin (fast, 1-3s)
  * 2. If it doesn't exist, load .osm (slow, 5-30s) and generate .bin
  * 3. If .osm doesn't exist, error
+ *
+ * ALT landmarks and Contraction Hierarchies are cached the same way in
+ * data/graphs/{baseName}.landmarks and data/graphs/{baseName}.ch (one table
+ * per vehicle profile, rebuilt if the graph changed).
  */
 class GraphService : public QObject {
     Q_OBJECT
 
 private: 
     std::shared_ptr<Graph> graph;
+    std::shared_ptr<LandmarkStore> landmarkStore;
+    std::shared_ptr<ContractionHierarchyStore> hierarchyStore;
     std::atomic<bool> cancelRequested = {false};
     QFuture<void> loadFuture_;
 
@@ -28,6 +36,15 @@ private:
 
     bool fileExists(const QString& path) const;
 
+    // Blocked road classes to preprocess: no restrictions plus every factory profile
+    static std::vector<std::vector<char>> getProfileRestrictions(const CsrGraph& csr);
+
+    // Load landmark tables from disk, build the missing ones and save them
+    void prepareLandmarks(const QString& baseName);
+
+    // Same for the Contraction Hierarchies
+    void prepareContractionHierarchies(const QString& baseName);
+
 public:
     explicit GraphService(QObject* parent = nullptr);
     ~GraphService();
@@ -48,6 +65,12 @@ public:
     // Return the graph loaded (return nullptr if there isn't any)
     std::shared_ptr<Graph> getGraph() const;
 
+    // ALT landmark tables of the loaded graph
+    std::shared_ptr<LandmarkStore> getLandmarkStore() const { return landmarkStore; }
+
+    // Contraction Hierarchies of the loaded graph
+    std::shared_ptr<ContractionHierarchyStore> getHierarchyStore() const { return hierarchyStore; }
+
 signals:
     // Emited when the graph is loaded
     void graphLoaded(const std::shared_ptr<Graph>& graph, qint64 loadTimeMs);
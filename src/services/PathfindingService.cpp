@@ -1,5 +1,7 @@
 #include "PathfindingService.h"
 #include "../algorithms/factories/AlgorithmFactory.h"
+#include "../algorithms/pathfinding/ALTAlgorithm.h"
+#include "../algorithms/pathfinding/ContractionHierarchyAlgorithm.h"
 #include "../utils/exceptions/GraphException.h"
 #include <QtConcurrent/QtConcurrent>
 #include <chrono>
@@ -8,6 +10,8 @@
 PathfindingService::PathfindingService(QObject* parent)
     : QObject(parent)
     , graph_(nullptr)
+    , landmarkStore_(std::make_shared<LandmarkStore>())
+    , hierarchyStore_(std::make_shared<ContractionHierarchyStore>())
 {}
 
 PathfindingService::PathResult PathfindingService::findPathSync(
@@ -25,14 +29,17 @@ PathfindingService::PathResult PathfindingService::findPathSync(
     // Create algorithm
     auto algorithm = AlgorithmFactory::createAlgorithm(algorithmName);
     
-    // Execute pathfinding
-    std::vector<int64_t> path;
-    if (vehicleProfile) {
-        path = algorithm->findPath(*graph_, startId, endId, vehicleProfile);
-    } else {
-        path = algorithm->findPath(*graph_, startId, endId);
+    // ALT/CH reuse the preprocessed data instead of building their own
+    if (auto altAlgo = dynamic_cast<ALTAlgorithm*>(algorithm.get())) {
+        altAlgo->setLandmarkStore(landmarkStore_);
+    } else if (auto chAlgo = dynamic_cast<ContractionHierarchyAlgorithm*>(algorithm.get())) {
+        chAlgo->setHierarchyStore(hierarchyStore_);
     }
     
+    // Execute pathfinding (workspace returns to the pool at end of scope)
+    auto workspace = workspacePool_.acquire();
+    std::vector<int64_t> path = algorithm->findPath(*graph_, startId, endId, vehicleProfile, *workspace);
+    
     auto endTime = std::chrono::high_resolution_clock::now();
     double executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
     
@@ -8,6 +8,9 @@
 #include "../core/entities/Graph.h"
 #include "../core/interfaces/IPathfindingAlgorithm.h"
 #include "../algorithms/VehicleProfile.h"
+#include "../algorithms/pathfinding/SearchWorkspace.h"
+#include "../algorithms/pathfinding/LandmarkTable.h"
+#include "../algorithms/pathfinding/ContractionHierarchy.h"
 
 /**
  * @brief Service for calculating shortest paths
@@ -41,6 +44,13 @@ private:
     std::shared_ptr<Graph> graph_;
     QFuture<void> pathFuture_;
     
+    // Search state reused across queries (one workspace per concurrent worker thread)
+    SearchWorkspacePool workspacePool_;
+    
+    // Preprocessed data (shared with GraphService, which loads/persists it)
+    std::shared_ptr<LandmarkStore> landmarkStore_;
+    std::shared_ptr<ContractionHierarchyStore> hierarchyStore_;
+    
 public:
     explicit PathfindingService(QObject* parent = nullptr);
     
@@ -49,6 +59,15 @@ public:
      */
     void setGraph(std::shared_ptr<Graph> graph) {
         graph_ = graph;
+        workspacePool_.clear();
+    }
+    
+    void setLandmarkStore(std::shared_ptr<LandmarkStore> store) {
+        landmarkStore_ = store;
+    }
+    
+    void setHierarchyStore(std::shared_ptr<ContractionHierarchyStore> store) {
+        hierarchyStore_ = store;
     }
     
     /**
@@ -1,7 +1,14 @@
 #include "TspService.h"
 #include "../algorithms/tsp/TspMatrix.h"
-#include "../algorithms/tsp/IGAlgorithm.h"
+#include "../algorithms/tsp/IGSAAlgorithm.h"
+#include "../algorithms/tsp/HeldKarpAlgorithm.h"
+#include "../algorithms/tsp/ParallelTspRunner.h"
+#include "../algorithms/tsp/PipelinedTspSolver.h"
+#include "../algorithms/tsp/OneTreeBound.h"
+#include "../algorithms/tsp/TourConstruction.h"
 #include "../algorithms/factories/AlgorithmFactory.h"
+#include "../algorithms/pathfinding/ALTAlgorithm.h"
+#include "../algorithms/pathfinding/ContractionHierarchyAlgorithm.h"
 #include "../algorithms/factories/TspAlgorithmFactory.h"
 #include "../utils/exceptions/GraphException.h"
 #include "../utils/exceptions/TspException.h"
@@ -13,14 +20,26 @@
 TspService::TspService(QObject* parent)
     : QObject(parent)
     , graph_(nullptr)
+    , landmarkStore_(std::make_shared<LandmarkStore>())
+    , hierarchyStore_(std::make_shared<ContractionHierarchyStore>())
+    , exactMaxSize_(HeldKarpAlgorithm::AUTO_SELECT_MAX_SIZE)
+    , timeLimitSeconds_(0.0)
+    , pipelined_(false)
+    , construction_(TourConstruction::NEAREST_NEIGHBOR)
+    , targetGap_(0.0)
 {}
 
+void TspService::setExactSolverMaxSize(size_t maxSize) {
+    exactMaxSize_ = std::min(maxSize, HeldKarpAlgorithm::MAX_SIZE);
+}
+
 void TspService::solveAsync(
     const std::vector<int64_t>& waypointIds,
     const std::string& tspAlgorithmName,
     const std::string& pathfindingAlgorithmName,
     const VehicleProfile* vehicleProfile,
-    bool returnToStart
+    bool returnToStart,
+    int threads
 ) {
     // Copiar VehicleProfile si existe (para evitar use-after-free en thread asíncrono)
     std::unique_ptr<VehicleProfile> vehicleProfileCopy = nullptr;
@@ -30,7 +49,10 @@ void TspService::solveAsync(
     
     // Run in Qt thread pool (thread-safe with Qt signals)
     tspFuture_ = QtConcurrent::run([this, waypointIds, tspAlgorithmName, pathfindingAlgorithmName, 
-                                    vehicleProfileCopy = std::move(vehicleProfileCopy), returnToStart]() {
+                                    vehicleProfileCopy = std::move(vehicleProfileCopy), returnToStart, threads,
+                                    exactMaxSize = exactMaxSize_, timeLimit = timeLimitSeconds_, seed = seed_,
+                                    pipelined = pipelined_, construction = construction_,
+                                    targetGap = targetGap_]() {
         try {
             if (!graph_) {
                 throw GraphException("Graph not loaded");
@@ -72,15 +94,54 @@ void TspService::solveAsync(
             
             auto pathfindingAlgo = AlgorithmFactory::createAlgorithm(pathfindingAlgorithmName);
             
-            matrix.precompute(
-                *graph_,
-                pathfindingAlgo.get(),
-                vehicleProfileCopy.get(),  // Usar la copia
-                [this](int current, int total, int percent) {
-                    // Emit progress (thread-safe with Qt::QueuedConnection)
-                    emit precomputeProgress(percent);
+            // ALT/CH reuse the preprocessed data instead of building their own
+            if (auto altAlgo = dynamic_cast<ALTAlgorithm*>(pathfindingAlgo.get())) {
+                altAlgo->setLandmarkStore(landmarkStore_);
+            } else if (auto chAlgo = dynamic_cast<ContractionHierarchyAlgorithm*>(pathfindingAlgo.get())) {
+                chAlgo->setHierarchyStore(hierarchyStore_);
+            }
+            
+            // Exactly with Held-Karp when small enough (solved in milliseconds)
+            const bool exact = waypointIds.size() <= exactMaxSize;
+            
+            auto runPrecompute = [&](const TspMatrix::RowCallback& onRow) {
+                matrix.precompute(
+                    *graph_,
+                    pathfindingAlgo.get(),
+                    vehicleProfileCopy.get(),  // Usar la copia
+                    [this](int current, int total, int percent) {
+                        // Emit progress (thread-safe with Qt::QueuedConnection)
+                        emit precomputeProgress(percent);
+                    },
+                    onRow
+                );
+            };
+            
+            // Pipelined: search on straight-line estimates while the rows are computed
+            std::vector<int> warmTour;
+            if (pipelined && !exact) {
+                TspMatrix working(n, waypointIds);
+                working.estimateFromCoordinates(*graph_);
+                
+                // A single thread, the precompute workers use every core
+                PipelinedTspSolver pipeline(
+                    [tspAlgorithmName, construction]() {
+                        auto algorithm = TspAlgorithmFactory::create(tspAlgorithmName);
+                        algorithm->setConstruction(construction);
+                        if (auto igsaAlgo = dynamic_cast<IGSAAlgorithm*>(algorithm.get())) {
+                            igsaAlgo->setNumThreads(1);
+                        }
+                        return algorithm;
+                    },
+                    returnToStart
+                );
+                if (seed) {
+                    pipeline.setSeed(*seed);
                 }
-            );
+                warmTour = pipeline.warmStart(matrix, working, waypointIds, runPrecompute);
+            } else {
+                runPrecompute(nullptr);
+            }
             
             auto precomputeEndTime = std::chrono::high_resolution_clock::now();
             double precomputeTimeMs = std::chrono::duration<double, std::milli>(
@@ -121,14 +182,81 @@ void TspService::solveAsync(
                 );
             }
             
-            // 3. Solve TSP
-            auto tspAlgo = TspAlgorithmFactory::create(tspAlgorithmName);
+            // 2.6. Lower bound of the optimum (1-trees), so every tour comes with its gap;
+            //      Held-Karp needs none, its tour is optimal
+            double lowerBound = 0.0;
+            if (!exact) {
+                std::vector<int> upperTour = warmTour.empty() ? constructTour(construction, matrix, returnToStart) : warmTour;
+                OneTreeBound bound(matrix, returnToStart);
+                lowerBound = bound.compute(matrix.calculateTourCost(upperTour, returnToStart),
+                                           OneTreeBound::DEFAULT_ITERATIONS, LOWER_BOUND_TIME_LIMIT_SECONDS);
+                std::cout << "   Lower bound (1-tree): " << lowerBound << std::endl;
+            }
+            
+            // 3. Solve TSP (re-optimising the warm-up tour on the exact matrix, if any)
+            std::unique_ptr<ITspAlgorithm> tspAlgo;
+            if (exact) {
+                std::cout << "   " << waypointIds.size() << " waypoints: solving exactly with Held-Karp" << std::endl;
+                tspAlgo = std::make_unique<HeldKarpAlgorithm>();
+            } else {
+                tspAlgo = TspAlgorithmFactory::create(tspAlgorithmName);
+            }
             
-            // Configure returnToStart if IG
-            if (auto igAlgo = dynamic_cast<IGAlgorithm*>(tspAlgo.get())) {
-                igAlgo->setReturnToStart(returnToStart);
+            // Threads: IGSA and Held-Karp parallelise internally, the rest run as islands
+            if (auto hkAlgo = dynamic_cast<HeldKarpAlgorithm*>(tspAlgo.get())) {
+                if (threads > 0) {
+                    hkAlgo->setNumThreads(threads);
+                }
+            } else if (auto igsaAlgo = dynamic_cast<IGSAAlgorithm*>(tspAlgo.get())) {
+                if (threads > 0) {
+                    igsaAlgo->setNumThreads(threads);
+                }
+            } else if (threads > 1) {
+                tspAlgo = std::make_unique<ParallelTspRunner>(
+                    [tspAlgorithmName]() { return TspAlgorithmFactory::create(tspAlgorithmName); },
+                    threads,
+                    threads
+                );
             }
             
+            tspAlgo->setReturnToStart(returnToStart);
+            tspAlgo->setConstruction(construction);
+            if (!warmTour.empty()) {
+                tspAlgo->setInitialTour(warmTour);
+            }
+            if (timeLimit > 0.0) {
+                tspAlgo->setTimeLimit(timeLimit);
+            }
+            if (seed) {
+                tspAlgo->setSeed(*seed);
+            }
+            if (targetGap > 0.0 && lowerBound > 0.0) {
+                tspAlgo->setTargetGap(lowerBound, targetGap);
+            }
+            
+            // Anytime results: improved tours while the algorithm runs, without leg
+            // paths and at most one per IMPROVEMENT_INTERVAL_MS (the UI is not flooded)
+            double lastImprovementMs = -IMPROVEMENT_INTERVAL_MS;
+            tspAlgo->setImprovementCallback(
+                [&](const std::vector<int>& tour, double cost, double elapsedMs) {
+                    if (elapsedMs - lastImprovementMs < IMPROVEMENT_INTERVAL_MS) {
+                        return;
+                    }
+                    lastImprovementMs = elapsedMs;
+                    
+                    TspResult partial;
+                    partial.tour = tour;
+                    partial.nodeIds = waypointIds;
+                    partial.totalDistance = cost;
+                    partial.executionTimeMs = precomputeTimeMs + elapsedMs;
+                    partial.precomputeTimeMs = precomputeTimeMs;
+                    partial.tspAlgorithmName = exact ? "heldkarp" : tspAlgorithmName;
+                    partial.isFinal = false;
+                    partial.lowerBound = lowerBound;
+                    partial.optimalityGap = OneTreeBound::gap(cost, lowerBound);
+                    emit tspImproved(partial);
+                });
+            
             auto tspStartTime = std::chrono::high_resolution_clock::now();
             std::vector<int> tour = tspAlgo->solve(matrix, waypointIds);
             auto tspEndTime = std::chrono::high_resolution_clock::now();
@@ -150,6 +278,10 @@ void TspService::solveAsync(
             
             size_t numSegments = returnToStart ? tour.size() : tour.size() - 1;
             
+            // Only the legs of the chosen tour get a path
+            std::vector<std::vector<int64_t>> legPaths = matrix.materializeTourPaths(
+                *graph_, pathfindingAlgo.get(), vehicleProfileCopy.get(), tour, returnToStart);
+            
             for (size_t i = 0; i < numSegments; ++i) {
                 int fromIdx = tour[i];
                 int toIdx = tour[(i + 1) % tour.size()];
@@ -157,8 +289,7 @@ void TspService::solveAsync(
                 int64_t fromNodeId = waypointIds[fromIdx];
                 int64_t toNodeId = waypointIds[toIdx];
                 
-                // Get the path for this segment from the matrix
-                auto segmentPath = matrix.getPath(fromIdx, toIdx);
+                const std::vector<int64_t>& segmentPath = legPaths[i];
                 
                 std::vector<Edge*> edges;
                 std::vector<int64_t> nodes;
@@ -195,7 +326,9 @@ void TspService::solveAsync(
             result.totalDistance = totalDistance;
             result.executionTimeMs = totalTimeMs;
             result.precomputeTimeMs = precomputeTimeMs;
-            result.tspAlgorithmName = tspAlgorithmName;
+            result.tspAlgorithmName = exact ? "heldkarp" : tspAlgorithmName;
+            result.lowerBound = exact ? totalDistance : lowerBound;
+            result.optimalityGap = exact ? 0.0 : OneTreeBound::gap(totalDistance, lowerBound);
             
             emit tspSolved(result);
             
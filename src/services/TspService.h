@@ -3,10 +3,14 @@
 #include <QObject>
 #include <QFuture>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <cstdint>
 #include "../core/entities/Graph.h"
+#include "../core/interfaces/ITspAlgorithm.h"
 #include "../algorithms/VehicleProfile.h"
+#include "../algorithms/pathfinding/LandmarkTable.h"
+#include "../algorithms/pathfinding/ContractionHierarchy.h"
 
 /**
  * @brief Service for solving TSP
@@ -32,18 +36,54 @@ public:
         double executionTimeMs;
         double precomputeTimeMs;
         std::string tspAlgorithmName;
+        bool isFinal;                                   // false = intermediate tour (no segments yet)
+        double lowerBound;                              // Optimal distance is at least this (0 = unknown)
+        double optimalityGap;                           // (totalDistance - lowerBound) / lowerBound, -1 = unknown
         
         TspResult()
             : totalDistance(0.0)
             , executionTimeMs(0.0)
             , precomputeTimeMs(0.0)
+            , isFinal(true)
+            , lowerBound(0.0)
+            , optimalityGap(-1.0)
         {}
     };
     
+    /**
+     * @brief Minimum time between two tspImproved() signals of one solve
+     */
+    static constexpr double IMPROVEMENT_INTERVAL_MS = 50.0;
+    
+    /**
+     * @brief Budget of the lower-bound computation of one solve (OneTreeBound)
+     */
+    static constexpr double LOWER_BOUND_TIME_LIMIT_SECONDS = 0.5;
+    
 private:
     std::shared_ptr<Graph> graph_;
     QFuture<void> tspFuture_;
     
+    // Preprocessed data for ALT/CH precompute (shared with GraphService)
+    std::shared_ptr<LandmarkStore> landmarkStore_;
+    std::shared_ptr<ContractionHierarchyStore> hierarchyStore_;
+    
+    // Up to this many waypoints the tour is solved exactly (Held-Karp)
+    size_t exactMaxSize_;
+    
+    // Solver settings applied to every solve (0 = no time limit, nullopt = random seed)
+    double timeLimitSeconds_;
+    std::optional<uint64_t> seed_;
+    
+    // Start solving on estimated distances while the matrix is computed
+    bool pipelined_;
+    
+    // Starting tour of the TSP algorithm
+    TourConstruction construction_;
+    
+    // Stop the algorithm within this relative gap of the lower bound (0 = off)
+    double targetGap_;
+    
 public:
     explicit TspService(QObject* parent = nullptr);
     
@@ -51,25 +91,103 @@ public:
         graph_ = graph;
     }
     
+    void setLandmarkStore(std::shared_ptr<LandmarkStore> store) {
+        landmarkStore_ = store;
+    }
+    
+    void setHierarchyStore(std::shared_ptr<ContractionHierarchyStore> store) {
+        hierarchyStore_ = store;
+    }
+    
+    /**
+     * @brief Waypoint count up to which Held-Karp replaces the chosen algorithm
+     * 
+     * Default HeldKarpAlgorithm::AUTO_SELECT_MAX_SIZE; 0 always runs the
+     * chosen algorithm (e.g. to benchmark heuristics on small instances).
+     * Values above HeldKarpAlgorithm::MAX_SIZE are capped.
+     */
+    void setExactSolverMaxSize(size_t maxSize);
+    
+    /**
+     * @brief Wall-clock budget of the TSP algorithm (matrix precompute not
+     *        included), for interactive latency bounds; 0 = iterations only
+     */
+    void setTimeLimit(double seconds) {
+        timeLimitSeconds_ = seconds;
+    }
+    
+    /**
+     * @brief Fixed seed for reproducible runs (nullopt = new random seed each solve)
+     */
+    void setSeed(std::optional<uint64_t> seed) {
+        seed_ = seed;
+    }
+    
+    /**
+     * @brief Pipelined mode: overlap the matrix precompute with the search
+     * 
+     * The algorithm starts on straight-line estimates and picks up the
+     * exact rows as they land (PipelinedTspSolver); once the matrix is
+     * complete, its tour is re-optimised on the exact distances. Off by
+     * default; not used when Held-Karp solves the instance.
+     */
+    void setPipelined(bool pipelined) {
+        pipelined_ = pipelined;
+    }
+    
+    /**
+     * @brief Heuristic for the algorithm's starting tour (default Nearest Neighbor)
+     * 
+     * SPACE_FILLING_CURVE orders the waypoints by their coordinates without
+     * reading distances: an instant rough tour for very large stop lists.
+     */
+    void setConstruction(TourConstruction construction) {
+        construction_ = construction;
+    }
+    
+    /**
+     * @brief Stop the search once the tour is provably within gap of optimal
+     * 
+     * Every heuristic solve computes a Held-Karp (1-tree) lower bound,
+     * reported in TspResult::lowerBound / optimalityGap. With a target gap,
+     * e.g. 0.02, the algorithm stops as soon as its best tour is at most 2%
+     * above that bound instead of running all its iterations. 0 = off.
+     */
+    void setTargetGap(double gap) {
+        targetGap_ = gap;
+    }
+    
     /**
      * @brief Solves TSP (ASYNC - does NOT freeze UI)
      * 
      * Steps:
      * 1. Create TspMatrix
      * 2. Precompute (emits progress signals)
-     * 3. Solve with TSP algorithm
+     * 3. Solve with TSP algorithm (Held-Karp if few waypoints, see setExactSolverMaxSize),
+     *    emitting tspImproved() as better tours are found
      * 4. Emit tspSolved()
+     * 
+     * @param threads Solver threads: 0 = algorithm default (IGSA uses all cores,
+     *        the others one); N > 0 = N annealing chains for IGSA, N islands
+     *        of a ParallelTspRunner for the others (1 = sequential)
      */
     void solveAsync(
         const std::vector<int64_t>& waypointIds,
         const std::string& tspAlgorithmName,
         const std::string& pathfindingAlgorithmName = "dijkstra",
         const VehicleProfile* vehicleProfile = nullptr,
-        bool returnToStart = false
+        bool returnToStart = false,
+        int threads = 0
     );
     
 signals:
     void precomputeProgress(int percent);
     void tspSolved(TspResult result);
+    
+    /**
+     * @brief Better tour found while solving (tour, totalDistance and times
+     *        filled, segments empty); tspSolved() still follows
+     */
+    void tspImproved(TspResult result);
     void tspError(QString errorMessage);
 };
\ No newline at end of file
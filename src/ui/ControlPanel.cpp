@@ -84,6 +84,8 @@ void ControlPanel::setupUi() {
     pathfindingAlgorithmCombo_->addItem("Dijkstra");
     pathfindingAlgorithmCombo_->addItem("A*");
     pathfindingAlgorithmCombo_->addItem("ALT");
+    pathfindingAlgorithmCombo_->addItem("Dijkstra Bidireccional");
+    pathfindingAlgorithmCombo_->addItem("Contraction Hierarchies");
     pathfindingAlgorithmCombo_->setCurrentIndex(0);
     pathfindingAlgorithmCombo_->setMinimumWidth(200);
     pathfindingAlgorithmCombo_->setMinimumHeight(30);
@@ -104,6 +106,9 @@ void ControlPanel::setupUi() {
     tspAlgorithmCombo_->addItem("IG (Iterated Greedy)");
     tspAlgorithmCombo_->addItem("ILS_B (Iterated Local Search B)");
     tspAlgorithmCombo_->addItem("IGSA (IG + Simulated Annealing)");
+    tspAlgorithmCombo_->addItem("ILS_DB (ILS + Double-Bridge / Or-opt)");
+    tspAlgorithmCombo_->addItem("LK (Lin-Kernighan encadenado)");
+    tspAlgorithmCombo_->addItem("Held-Karp (exacto, hasta 20 paradas)");
     tspAlgorithmCombo_->setCurrentIndex(0);
     tspAlgorithmCombo_->setMinimumWidth(200);
     tspAlgorithmCombo_->setMinimumHeight(30);
@@ -293,6 +298,8 @@ void ControlPanel::onPathfindingAlgorithmChanged(int index) {
         case 0: algorithm = "dijkstra"; break;
         case 1: algorithm = "astar"; break;
         case 2: algorithm = "alt"; break;
+        case 3: algorithm = "bidijkstra"; break;
+        case 4: algorithm = "ch"; break;
         default: algorithm = "dijkstra";
     }
     
@@ -306,6 +313,9 @@ void ControlPanel::onTspAlgorithmChanged(int index) {
         case 0: algorithm = "ig"; break;
         case 1: algorithm = "ils_b"; break;
         case 2: algorithm = "igsa"; break;
+        case 3: algorithm = "ils_db"; break;
+        case 4: algorithm = "lk"; break;
+        case 5: algorithm = "heldkarp"; break;
         default: algorithm = "ig";
     }
     
@@ -167,7 +167,7 @@ void ResultsPanel::displayTspResult(const TspService::TspResult& result) {
     
     // Resumen
     double timeMs = calculateTime(result.totalDistance);
-    summaryLabel_->setText(QString(
+    QString summary = QString(
         "<b>Distancia Total del Tour:</b> %1<br>"
         "<b>Tiempo Estimado:</b> %2<br>"
         "<b>Nodos Visitados:</b> %3<br>"
@@ -175,7 +175,14 @@ void ResultsPanel::displayTspResult(const TspService::TspResult& result) {
     ).arg(formatDistance(result.totalDistance))
      .arg(formatTime(timeMs))
      .arg(result.nodeIds.size())
-     .arg(QString::fromStdString(result.tspAlgorithmName).toUpper()));
+     .arg(QString::fromStdString(result.tspAlgorithmName).toUpper());
+    if (result.optimalityGap >= 0.0) {
+        // Distance above the lower bound: the tour is at most this far from optimal
+        summary += QString("<br><b>Gap de Optimalidad:</b> %1% (cota %2)")
+            .arg(result.optimalityGap * 100.0, 0, 'f', 2)
+            .arg(formatDistance(result.lowerBound));
+    }
+    summaryLabel_->setText(summary);
     
     // Construir cadena de tour
     QString tourPath = "Inicio";
@@ -3,6 +3,7 @@
 #include "../services/GraphService.h"
 #include "../services/PathfindingService.h"
 #include "../services/TspService.h"
+#include "../services/DistanceTableService.h"
 #include "../algorithms/factories/VehicleProfileFactory.h"
 #include <QMenuBar>
 #include <QMenu>
@@ -27,6 +28,7 @@ MainWindow::MainWindow(QWidget* parent)
     graphService_ = new services::GraphService();
     pathfindingService_ = new PathfindingService();
     tspService_ = new TspService();
+    distanceTableService_ = new DistanceTableService();
     
     setupUi();
     setupMenuBar();
@@ -40,6 +42,7 @@ MainWindow::~MainWindow() {
     delete graphService_;
     delete pathfindingService_;
     delete tspService_;
+    delete distanceTableService_;
     
     if (lastPathResult_) {
         delete static_cast<PathfindingService::PathResult*>(lastPathResult_);
@@ -177,6 +180,18 @@ void MainWindow::connectSignals() {
                 onTspSolved();
             });
 
+    // Intermediate tours: only the distance so far (legs arrive with tspSolved)
+    connect(tspService_, &TspService::tspImproved,
+            this, [this](const TspService::TspResult& result) {
+                QString message = QString("Optimizando TSP: %1 m (%2 ms)")
+                    .arg(result.totalDistance, 0, 'f', 1)
+                    .arg(result.executionTimeMs, 0, 'f', 0);
+                if (result.optimalityGap >= 0.0) {
+                    message += QString(", gap %1%").arg(result.optimalityGap * 100.0, 0, 'f', 2);
+                }
+                statusBar()->showMessage(message);
+            });
+
     connect(tspService_, &TspService::tspError,
             this, &MainWindow::onTspError);
 
@@ -202,7 +217,13 @@ void MainWindow::onGraphLoaded(std::shared_ptr<Graph> graph, qint64 loadTimeMs)
     
     // Actualizar servicios
     pathfindingService_->setGraph(graph);
+    pathfindingService_->setLandmarkStore(graphService_->getLandmarkStore());
+    pathfindingService_->setHierarchyStore(graphService_->getHierarchyStore());
+    tspService_->setLandmarkStore(graphService_->getLandmarkStore());
+    tspService_->setHierarchyStore(graphService_->getHierarchyStore());
     tspService_->setGraph(graph);
+    distanceTableService_->setHierarchyStore(graphService_->getHierarchyStore());
+    distanceTableService_->setGraph(graph);
     
     statusBar()->showMessage(
         QString("Grafo cargado: %1 nodos, %2 aristas (%3 ms)")
@@ -481,6 +502,7 @@ void MainWindow::onTspSolved() {
     qDebug() << "   Distancia total:" << result.totalDistance << "m";
     qDebug() << "   Orden de visita:" << result.tour.size() << "nodos";
     qDebug() << "   Segmentos:" << result.segmentEdges.size();
+    qDebug() << "   Cota inferior:" << result.lowerBound << "m";
 
     // Actualizar mapa (mostrar todo el tour, sin resaltar segmento específico)
     mapWidget_->displayTspTour(result.segmentEdges, -1);
@@ -15,6 +15,7 @@
 class Graph; 
 class PathfindingService; 
 class TspService;
+class DistanceTableService;
 
 namespace services {
 class GraphService;
@@ -92,6 +93,7 @@ private:
     services::GraphService* graphService_;
     PathfindingService* pathfindingService_;
     TspService* tspService_;
+    DistanceTableService* distanceTableService_;
 
     // WIDGETS
     MapWidget* mapWidget_;
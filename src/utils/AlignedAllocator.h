@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+/**
+ * @brief std::allocator replacement returning Alignment-byte aligned storage
+ *
+ * For hot flat buffers (e.g. std::vector<double, AlignedAllocator<double>>)
+ * that should start on a cache-line boundary.
+ */
+template <class T, size_t Alignment = 64>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template <class U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <class U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* pointer, size_t) noexcept {
+        ::operator delete(pointer, std::align_val_t(Alignment));
+    }
+
+    template <class U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+    template <class U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
@@ -0,0 +1,121 @@
+#include "gtest/gtest.h"
+#include "../../src/core/entities/Graph.h"
+#include "../../src/core/entities/CsrGraph.h"
+#include "../../src/core/value_objects/Distance.h"
+
+class CsrGraphTest : public ::testing::Test {
+protected:
+    Graph testGraph;
+
+    void SetUp() override {
+        testGraph.addNode(30, 1, 0);
+        testGraph.addNode(10, 0, 0);
+        testGraph.addNode(20, 0, 1);
+
+        testGraph.addEdge(100, 10, 20, Distance(4.0), false, {{"highway", "primary"}});
+        testGraph.addEdge(101, 20, 10, Distance(4.0), false, {{"highway", "primary"}});
+        testGraph.addEdge(102, 10, 30, Distance(1.0), true, {{"highway", "footway"}});
+        testGraph.addEdge(103, 20, 30, Distance(2.0), true);
+        testGraph.buildAdjacencyList();
+    }
+};
+
+TEST_F(CsrGraphTest, SnapshotBuiltWithAdjacencyList) {
+    auto csr = testGraph.getCsrGraph();
+    ASSERT_NE(csr, nullptr);
+    EXPECT_EQ(csr->getNodeCount(), 3);
+    EXPECT_EQ(csr->getArcCount(), 4);
+
+    testGraph.clear();
+    EXPECT_EQ(testGraph.getCsrGraph(), nullptr);
+}
+
+TEST_F(CsrGraphTest, DenseIndicesSortedById) {
+    auto csr = testGraph.getCsrGraph();
+    EXPECT_EQ(csr->getNodeIndex(10), 0u);
+    EXPECT_EQ(csr->getNodeIndex(20), 1u);
+    EXPECT_EQ(csr->getNodeIndex(30), 2u);
+    EXPECT_EQ(csr->getNodeIndex(99), CsrGraph::INVALID_INDEX);
+    EXPECT_EQ(csr->getNodeId(2), 30);
+    EXPECT_DOUBLE_EQ(csr->getLatitude(2), 1.0);
+}
+
+TEST_F(CsrGraphTest, ArcsMatchOutgoingEdges) {
+    auto csr = testGraph.getCsrGraph();
+    uint32_t a = csr->getNodeIndex(10);
+
+    ASSERT_EQ(csr->arcEnd(a) - csr->arcBegin(a), 2u) << "Nodo 10 debe tener 2 arcos salientes";
+    for (uint32_t arc = csr->arcBegin(a); arc < csr->arcEnd(a); arc++) {
+        EXPECT_EQ(csr->getArcSource(arc), a);
+        const Edge* edge = testGraph.getEdge(csr->getArcEdgeId(arc));
+        ASSERT_NE(edge, nullptr);
+        EXPECT_EQ(csr->getNodeId(csr->getArcTarget(arc)), edge->getTarget()->getId());
+        EXPECT_DOUBLE_EQ(csr->getArcWeight(arc), edge->getDistance().getMeters());
+    }
+
+    uint32_t c = csr->getNodeIndex(30);
+    EXPECT_EQ(csr->arcBegin(c), csr->arcEnd(c)) << "Nodo 30 no tiene arcos salientes (one-way)";
+}
+
+TEST_F(CsrGraphTest, ReverseIndexGroupsArcsByTarget) {
+    auto csr = testGraph.getCsrGraph();
+    uint32_t c = csr->getNodeIndex(30);
+
+    EXPECT_EQ(csr->inArcEnd(c) - csr->inArcBegin(c), 2u) << "Nodo 30 tiene 2 arcos entrantes";
+    EXPECT_EQ(testGraph.getIncomingEdges(30).size(), 2u);
+
+    size_t total = 0;
+    for (uint32_t node = 0; node < csr->getNodeCount(); node++) {
+        for (uint32_t i = csr->inArcBegin(node); i < csr->inArcEnd(node); i++) {
+            EXPECT_EQ(csr->getArcTarget(csr->getInArc(i)), node);
+            total++;
+        }
+    }
+    EXPECT_EQ(total, csr->getArcCount());
+}
+
+TEST_F(CsrGraphTest, RoadClassesFromHighwayTag) {
+    auto csr = testGraph.getCsrGraph();
+    const auto& classes = csr->getRoadClasses();
+    ASSERT_EQ(classes.size(), 3u);
+    EXPECT_EQ(classes[CsrGraph::NO_ROAD_CLASS], "");
+
+    uint32_t b = csr->getNodeIndex(20);
+    for (uint32_t arc = csr->arcBegin(b); arc < csr->arcEnd(b); arc++) {
+        const Edge* edge = testGraph.getEdge(csr->getArcEdgeId(arc));
+        std::string expected = edge->hasTag("highway") ? edge->getTag("highway") : "";
+        EXPECT_EQ(classes[csr->getArcRoadClass(arc)], expected);
+    }
+}
+
+TEST_F(CsrGraphTest, GraphAssignsDenseIndices) {
+    EXPECT_EQ(testGraph.getIndexedNodeCount(), 3u);
+    EXPECT_EQ(testGraph.getNodeIndex(30), 2u);
+    EXPECT_EQ(testGraph.getNodeByIndex(0)->getId(), 10);
+    EXPECT_EQ(testGraph.getEdgeIndex(102), 2u);
+    EXPECT_EQ(testGraph.getEdgeByIndex(3)->getId(), 103);
+    EXPECT_EQ(testGraph.getEdgeIndex(999), IdIndexTable::NOT_FOUND);
+
+    auto csr = testGraph.getCsrGraph();
+    for (uint32_t arc = 0; arc < csr->getArcCount(); arc++) {
+        EXPECT_EQ(csr->getEdgeId(csr->getArcEdgeIndex(arc)), csr->getArcEdgeId(arc));
+    }
+}
+
+TEST(IdIndexTableTest, InsertFindAndGrow) {
+    IdIndexTable table;
+    EXPECT_EQ(table.find(1), IdIndexTable::NOT_FOUND);
+
+    for (uint32_t i = 0; i < 1000; i++) {
+        table.insert(5000000000LL + i * 64, i);
+    }
+    EXPECT_EQ(table.size(), 1000u);
+    for (uint32_t i = 0; i < 1000; i++) {
+        EXPECT_EQ(table.find(5000000000LL + i * 64), i);
+    }
+    EXPECT_EQ(table.find(5000000001LL), IdIndexTable::NOT_FOUND);
+
+    table.insert(5000000000LL, 7);
+    EXPECT_EQ(table.find(5000000000LL), 7u) << "Insert sobre clave existente debe sobrescribir";
+    EXPECT_EQ(table.size(), 1000u);
+}
@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 #include "../../src/algorithms/pathfinding/DijkstraAlgorithm.h"
+#include "../../src/algorithms/pathfinding/BidirectionalDijkstraAlgorithm.h"
+#include "../../src/algorithms/pathfinding/ALTAlgorithm.h"
+#include "../../src/algorithms/pathfinding/ContractionHierarchyAlgorithm.h"
+#include "../../src/algorithms/pathfinding/ManyToManyTable.h"
 #include "../../src/core/entities/Graph.h"
 #include "../../src/core/entities/Node.h" 
 #include "../../src/core/entities/Edge.h" 
@@ -100,4 +104,138 @@ TEST_F(DijkstraTest, RestrictedPathVehicleProfile) {
         }
     }
     EXPECT_FALSE(tookRestrictedEdge) << "El camino no debe incluir la arista restringida 202";
-}
\ No newline at end of file
+}
+
+TEST_F(DijkstraTest, ReusedWorkspaceGivesSameResults) {
+    SearchWorkspace workspace;
+    for (int round = 0; round < 3; round++) {
+        std::vector<int64_t> path = dijkstra.findPath(testGraph, 10, 40, nullptr, workspace);
+        EXPECT_NEAR(calculatePathCost(testGraph, path), 6.0, 1e-6) << "Ronda " << round;
+
+        path = dijkstra.findPath(testGraph, 10, 50, &carProfile, workspace);
+        EXPECT_NEAR(calculatePathCost(testGraph, path), 5.0, 1e-6) << "Ronda " << round;
+
+        path = dijkstra.findPath(testGraph, 30, 30, nullptr, workspace);
+        EXPECT_TRUE(path.empty());
+    }
+}
+
+TEST_F(DijkstraTest, OneToManyMatchesPointToPoint) {
+    SearchWorkspace workspace;
+    std::vector<int64_t> targets = {10, 20, 30, 40, 50, 40};
+    const VehicleProfile* profiles[] = {nullptr, &carProfile};
+
+    for (const VehicleProfile* profile : profiles) {
+        for (int64_t start : targets) {
+            auto paths = dijkstra.findPathsToMany(testGraph, start, targets, profile, workspace);
+            ASSERT_EQ(paths.size(), targets.size());
+            for (size_t i = 0; i < targets.size(); i++) {
+                std::vector<int64_t> expected = dijkstra.findPath(testGraph, start, targets[i], profile);
+                EXPECT_NEAR(calculatePathCost(testGraph, paths[i]), calculatePathCost(testGraph, expected), 1e-6)
+                    << "Desde " << start << " hasta " << targets[i];
+                EXPECT_EQ(paths[i].size(), expected.size());
+            }
+        }
+    }
+}
+
+TEST_F(DijkstraTest, BidirectionalMatchesDijkstra) {
+    BidirectionalDijkstraAlgorithm bidirectional;
+    SearchWorkspace workspace;
+    const int64_t ids[] = {10, 20, 30, 40, 50};
+    for (int64_t from : ids) {
+        for (int64_t to : ids) {
+            double expected = calculatePathCost(testGraph, dijkstra.findPath(testGraph, from, to, &carProfile));
+            std::vector<int64_t> path = bidirectional.findPath(testGraph, from, to, &carProfile, workspace);
+            EXPECT_NEAR(calculatePathCost(testGraph, path), expected, 1e-6) << from << " -> " << to;
+        }
+    }
+
+    std::vector<int64_t> path = bidirectional.findPath(testGraph, 10, 50, &carProfile, workspace);
+    EXPECT_TRUE((path.size() == 2 && path[0] == 100 && path[1] == 200)) << "Debe evitar la arista restringida 202";
+}
+
+TEST_F(DijkstraTest, ALTMatchesDijkstra) {
+    ALTAlgorithm alt;
+    SearchWorkspace workspace;
+    const int64_t ids[] = {10, 20, 30, 40, 50};
+    const VehicleProfile* profiles[] = {nullptr, &carProfile};
+    for (const VehicleProfile* profile : profiles) {
+        for (int64_t from : ids) {
+            for (int64_t to : ids) {
+                double expected = calculatePathCost(testGraph, dijkstra.findPath(testGraph, from, to, profile));
+                std::vector<int64_t> path = alt.findPath(testGraph, from, to, profile, workspace);
+                EXPECT_NEAR(calculatePathCost(testGraph, path), expected, 1e-6) << from << " -> " << to;
+            }
+        }
+    }
+    EXPECT_EQ(alt.getLandmarkStore()->getTables().size(), 2u) << "Una tabla por conjunto de restricciones";
+}
+
+TEST_F(DijkstraTest, LandmarkBoundsAreAdmissible) {
+    auto csr = testGraph.getCsrGraph();
+    std::vector<char> blocked = carProfile.getBlockedRoadClasses(csr->getRoadClasses());
+    auto table = LandmarkTable::build(*csr, blocked, 3);
+    ASSERT_EQ(table->getLandmarkCount(), 3u);
+    EXPECT_EQ(table->getRestrictionKey(), "private");
+
+    std::vector<uint32_t> all = {0, 1, 2};
+    const int64_t ids[] = {10, 20, 30, 40, 50};
+    for (int64_t from : ids) {
+        for (int64_t to : ids) {
+            double exact = calculatePathCost(testGraph, dijkstra.findPath(testGraph, from, to, &carProfile));
+            double bound = table->lowerBound(csr->getNodeIndex(from), csr->getNodeIndex(to), all);
+            EXPECT_LE(bound, exact + 1e-9) << from << " -> " << to;
+        }
+    }
+}
+
+TEST_F(DijkstraTest, ContractionHierarchyMatchesDijkstra) {
+    ContractionHierarchyAlgorithm ch;
+    SearchWorkspace workspace;
+    const int64_t ids[] = {10, 20, 30, 40, 50};
+    const VehicleProfile* profiles[] = {nullptr, &carProfile};
+    for (const VehicleProfile* profile : profiles) {
+        for (int64_t from : ids) {
+            for (int64_t to : ids) {
+                std::vector<int64_t> expected = dijkstra.findPath(testGraph, from, to, profile);
+                std::vector<int64_t> path = ch.findPath(testGraph, from, to, profile, workspace);
+                EXPECT_NEAR(calculatePathCost(testGraph, path), calculatePathCost(testGraph, expected), 1e-6)
+                    << from << " -> " << to;
+                EXPECT_EQ(path.size(), expected.size()) << "Los atajos deben desempaquetarse a aristas originales";
+            }
+        }
+    }
+    EXPECT_EQ(ch.getHierarchyStore()->getHierarchies().size(), 2u);
+}
+
+TEST_F(DijkstraTest, ManyToManyTableMatchesDijkstra) {
+    ContractionHierarchyStore store;
+    SearchWorkspace workspace;
+    auto csr = testGraph.getCsrGraph();
+    const int64_t sourceIds[] = {10, 20, 50};
+    const int64_t targetIds[] = {10, 20, 30, 40, 50, 30};
+
+    std::vector<uint32_t> sources, targets;
+    for (int64_t id : sourceIds) sources.push_back(csr->getNodeIndex(id));
+    for (int64_t id : targetIds) targets.push_back(csr->getNodeIndex(id));
+
+    const VehicleProfile* profiles[] = {nullptr, &carProfile};
+    for (const VehicleProfile* profile : profiles) {
+        std::vector<char> blocked;
+        if (profile) blocked = profile->getBlockedRoadClasses(csr->getRoadClasses());
+        ManyToManyTable table(*store.getOrBuild(csr, blocked), targets, workspace);
+
+        std::vector<float> row(targets.size());
+        for (size_t i = 0; i < sources.size(); i++) {
+            table.computeRow(sources[i], row.data(), workspace);
+            for (size_t j = 0; j < targets.size(); j++) {
+                std::vector<int64_t> expected = dijkstra.findPath(testGraph, sourceIds[i], targetIds[j], profile);
+                double expectedCost = (expected.empty() && sourceIds[i] != targetIds[j])
+                    ? std::numeric_limits<double>::infinity()
+                    : calculatePathCost(testGraph, expected);
+                EXPECT_NEAR(row[j], expectedCost, 1e-4) << sourceIds[i] << " -> " << targetIds[j];
+            }
+        }
+    }
+}
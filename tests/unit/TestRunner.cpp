@@ -12,6 +12,8 @@
 #include "src/services/TspService.h"
 #include "src/algorithms/VehicleProfile.h"
 #include "src/algorithms/factories/VehicleProfileFactory.h"
+#include "src/algorithms/pathfinding/DijkstraAlgorithm.h"
+#include "src/algorithms/pathfinding/SearchWorkspace.h"
 
 using namespace services::io;
 
@@ -57,7 +59,9 @@ void runPathfindingTests(const std::shared_ptr<Graph>& graphPtr, const std::shar
     std::vector<std::string> pathfindingAlgorithms = {
         "dijkstra", 
         "astar",       
-        "alt"       
+        "alt",
+        "bidijkstra",
+        "ch"
     };
     PathfindingService pathService;
     pathService.setGraph(graphPtr);    
@@ -83,6 +87,35 @@ void runPathfindingTests(const std::shared_ptr<Graph>& graphPtr, const std::shar
     std::cout << "=======================================================\n";
 }
 
+void runQueueBenchmarks(const std::shared_ptr<Graph>& graphPtr, const std::shared_ptr<VehicleProfile>& profilePtr) {
+    std::cout << "\n=======================================================\n";
+    std::cout << "          COLAS DE PRIORIDAD: DIJKSTRA (mismos pares)    \n";
+    std::cout << "=======================================================\n";
+    auto test_pairs = generateRandomNodePairs(graphPtr, NUM_PATH_TESTS);
+    std::vector<QueueKind> queueKinds = {
+        QueueKind::BinaryHeap,
+        QueueKind::FourAryHeap,
+        QueueKind::RadixHeap
+    };
+    SearchWorkspace workspace;
+    std::cout << " Cola      | Tiempo (ms) | Nodos explorados promedio\n";
+    std::cout << "-------------------------------------------------------\n";
+    for (QueueKind kind : queueKinds) {
+        DijkstraAlgorithm dijkstra(kind);
+        double total_nodes = 0.0;
+        auto start = Clock::now();
+        for (const auto& pair : test_pairs) {
+            dijkstra.findPath(*graphPtr, pair.first, pair.second, profilePtr.get(), workspace);
+            total_nodes += dijkstra.getNodesExplored();
+        }
+        double avg_time_ms = duration_cast<microseconds>(Clock::now() - start).count() / (NUM_PATH_TESTS * 1000.0);
+        std::cout << std::left << std::setw(10) << queueKindName(kind)
+                  << " | " << std::fixed << std::setprecision(4) << avg_time_ms
+                  << " | " << std::fixed << std::setprecision(0) << total_nodes / NUM_PATH_TESTS << std::endl;
+    }
+    std::cout << "=======================================================\n";
+}
+
 void runTspTests(const std::shared_ptr<Graph>& graphPtr) {
     const Graph& graph = *graphPtr;
     std::cout << "\n=================================================================================\n";
@@ -158,6 +191,7 @@ int main() {
     std::shared_ptr<VehicleProfile> sharedProfile(defaultProfile.release());
     runStaticTests(graphPtr);
     runPathfindingTests(graphPtr, sharedProfile);
+    runQueueBenchmarks(graphPtr, sharedProfile);
     runTspTests(graphPtr);
     return 0;
 }
\ No newline at end of file
@@ -1,5 +1,24 @@
 #include "gtest/gtest.h"
 #include "../../src/algorithms/tsp/TspMatrix.h"
+#include "../../src/algorithms/tsp/TourMoveEvaluator.h"
+#include "../../src/algorithms/tsp/CandidateLocalSearch.h"
+#include "../../src/algorithms/factories/TspAlgorithmFactory.h"
+#include "../../src/algorithms/tsp/LKAlgorithm.h"
+#include "../../src/algorithms/tsp/IGSAAlgorithm.h"
+#include "../../src/algorithms/tsp/ParallelTspRunner.h"
+#include "../../src/algorithms/tsp/HeldKarpAlgorithm.h"
+#include "../../src/algorithms/tsp/PipelinedTspSolver.h"
+#include "../../src/algorithms/tsp/CheapestInsertion.h"
+#include "../../src/algorithms/tsp/IGAlgorithm.h"
+#include "../../src/algorithms/tsp/IGNAlgorithm.h"
+#include "../../src/algorithms/tsp/TourConstruction.h"
+#include "../../src/algorithms/tsp/OneTreeBound.h"
+#include "../../src/algorithms/pathfinding/DijkstraAlgorithm.h"
+#include "../../src/core/entities/Graph.h"
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
 
 class TspMatrixTest : public ::testing::Test {
 protected:
@@ -21,6 +40,71 @@ protected:
     }
 };
 
+namespace {
+    // Node ids 1..n
+    std::vector<int64_t> sequentialIds(size_t n) {
+        std::vector<int64_t> ids;
+        for (size_t i = 0; i < n; i++) ids.push_back(static_cast<int64_t>(i + 1));
+        return ids;
+    }
+
+    // Asymmetric matrix with costs uniform in [1, 100), reproducible from seed
+    TspMatrix randomMatrix(size_t n, unsigned int seed) {
+        TspMatrix matrix(n, sequentialIds(n));
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> cost(1.0, 100.0);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                if (i != j) matrix.setDistance(i, j, cost(rng));
+            }
+        }
+        return matrix;
+    }
+
+    // Optimal tour cost starting at index 0, by brute force over the other cities
+    double bruteForceOptimum(const TspMatrix& matrix, bool returnToStart) {
+        std::vector<int> perm;
+        for (size_t i = 1; i < matrix.getSize(); i++) perm.push_back(static_cast<int>(i));
+        double optimum = std::numeric_limits<double>::infinity();
+        do {
+            std::vector<int> tour = {0};
+            tour.insert(tour.end(), perm.begin(), perm.end());
+            optimum = std::min(optimum, matrix.calculateTourCost(tour, returnToStart));
+        } while (std::next_permutation(perm.begin(), perm.end()));
+        return optimum;
+    }
+
+    // Random stops in a ~10 km x 10 km box, straight-line distances in meters;
+    // going to a lower index costs backwardFactor times more (one-way streets)
+    TspMatrix planarMatrix(size_t n, unsigned int seed, double backwardFactor = 1.0,
+                           std::vector<Coordinate>* stops = nullptr) {
+        TspMatrix matrix(n, sequentialIds(n));
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> offset(0.0, 0.1);
+        std::vector<Coordinate> coordinates;
+        for (size_t i = 0; i < n; i++) coordinates.emplace_back(40.4 + offset(rng), -3.7 + offset(rng));
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                if (i == j) continue;
+                double d = coordinates[i].distanceTo(coordinates[j]);
+                matrix.setDistance(i, j, i < j ? d : d * backwardFactor);
+            }
+        }
+        if (stops) {
+            *stops = std::move(coordinates);
+        }
+        return matrix;
+    }
+
+    // tour visits every index 0..n-1 exactly once
+    void expectValidTour(const std::vector<int>& tour, size_t n) {
+        ASSERT_EQ(tour.size(), n);
+        std::vector<int> sorted = tour;
+        std::sort(sorted.begin(), sorted.end());
+        for (size_t i = 0; i < n; i++) EXPECT_EQ(sorted[i], static_cast<int>(i)) << "La ruta debe ser una permutación";
+    }
+}
+
 TEST_F(TspMatrixTest, CheckBasicAccessors) {
     EXPECT_EQ(matrix.getSize(), 4);
     EXPECT_NEAR(matrix.getEntry(0, 3).distance, 20.0, 1e-6);
@@ -55,4 +139,581 @@ TEST_F(TspMatrixTest, NearestNeighborHeuristic_StartFrom0) {
     EXPECT_EQ(actualTour, expectedTour);
     double cost = matrix.calculateTourCost(actualTour, false);
     EXPECT_NEAR(cost, 65.0, 1e-6);
-}
\ No newline at end of file
+}
+
+TEST(TspMatrixPrecomputeTest, StoresDistancesAndMaterializesTourLegs) {
+    Graph graph;
+    graph.addNode(1, 0, 0);
+    graph.addNode(2, 0, 1);
+    graph.addNode(3, 1, 1);
+    graph.addEdge(10, 1, 2, Distance(2.0));
+    graph.addEdge(11, 2, 3, Distance(3.0));
+    graph.addEdge(12, 3, 1, Distance(4.0));
+    graph.buildAdjacencyList();
+
+    std::vector<int64_t> ids = {3, 1, 2};
+    TspMatrix matrix(ids.size(), ids);
+    DijkstraAlgorithm dijkstra;
+    matrix.precompute(graph, &dijkstra);
+
+    EXPECT_EQ(matrix.getNodeIndex(2), 2u);
+    EXPECT_NEAR(matrix.getDistance(1, 0), 5.0, 1e-6) << "1 -> 2 -> 3";
+    EXPECT_NEAR(matrix.getDistance(0, 2), 6.0, 1e-6) << "3 -> 1 -> 2";
+    EXPECT_NEAR(matrix.getDistance(2, 2), 0.0, 1e-6);
+    EXPECT_NEAR(matrix.getEntryByNodeIds(2, 3).distance, 3.0, 1e-6);
+    EXPECT_THROW(matrix.getNodeIndex(99), std::runtime_error);
+
+    // Solo se materializan los tramos del tour elegido
+    std::vector<int> tour = {1, 2, 0};
+    auto legs = matrix.materializeTourPaths(graph, &dijkstra, nullptr, tour, true);
+    ASSERT_EQ(legs.size(), 3u);
+    EXPECT_EQ(legs[0], (std::vector<int64_t>{10}));
+    EXPECT_EQ(legs[1], (std::vector<int64_t>{11}));
+    EXPECT_EQ(legs[2], (std::vector<int64_t>{12}));
+    EXPECT_EQ(matrix.materializeTourPaths(graph, &dijkstra, nullptr, tour, false).size(), 2u);
+}
+
+TEST(TourMoveEvaluatorTest, DeltasMatchFullRecomputeOnAsymmetricMatrix) {
+    const size_t n = 7;
+    std::vector<int64_t> ids;
+    for (size_t i = 0; i < n; i++) ids.push_back(static_cast<int64_t>(100 + i));
+    TspMatrix matrix(n, ids);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            // Asimétrica: ida y vuelta con costos distintos
+            if (i != j) matrix.setDistance(i, j, static_cast<double>((i * 7 + j * 13) % 17 + 1 + (i < j ? 5 : 0)));
+        }
+    }
+
+    std::vector<int> route = {3, 0, 5, 1, 6, 2, 4};
+    for (bool returnToStart : {false, true}) {
+        TourMoveEvaluator evaluator(matrix, returnToStart);
+        evaluator.update(route);
+        double base = matrix.calculateTourCost(route, returnToStart);
+        EXPECT_NEAR(evaluator.tourCost(route), base, 1e-9);
+
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = i + 1; j < n; j++) {
+                std::vector<int> swapped = route;
+                std::swap(swapped[i], swapped[j]);
+                EXPECT_NEAR(evaluator.swapDelta(route, i, j), matrix.calculateTourCost(swapped, returnToStart) - base, 1e-9)
+                    << "swap " << i << "," << j << " cerrado=" << returnToStart;
+
+                std::vector<int> reversed = route;
+                std::reverse(reversed.begin() + i, reversed.begin() + j + 1);
+                EXPECT_NEAR(evaluator.reverseDelta(route, i, j), matrix.calculateTourCost(reversed, returnToStart) - base, 1e-9)
+                    << "reverse " << i << ".." << j << " cerrado=" << returnToStart;
+            }
+        }
+
+        // Or-opt: segmento [i, last] movido detrás de la posición j
+        for (size_t i = 0; i < n; i++) {
+            for (size_t last = i; last < i + 3 && last + 2 < n; last++) {
+                for (size_t j = 0; j < n; j++) {
+                    if ((j + 1 >= i && j <= last) || (returnToStart && i == 0 && j == n - 1)) continue;
+                    std::vector<int> moved = route;
+                    if (j > last) {
+                        std::rotate(moved.begin() + i, moved.begin() + last + 1, moved.begin() + j + 1);
+                    } else {
+                        std::rotate(moved.begin() + j + 1, moved.begin() + i, moved.begin() + last + 1);
+                    }
+                    EXPECT_NEAR(evaluator.orOptDelta(route, i, last, j), matrix.calculateTourCost(moved, returnToStart) - base, 1e-9)
+                        << "or-opt " << i << ".." << last << " -> " << j << " cerrado=" << returnToStart;
+                }
+            }
+        }
+    }
+}
+
+TEST(CandidateLocalSearchTest, ReachesTwoOptLocalOptimumWithFullNeighborLists) {
+    const size_t n = 40;
+    // Paradas aleatorias, con un recargo en un sentido (asimétrica)
+    TspMatrix matrix = planarMatrix(n, 42, 1.2);
+    std::mt19937 rng(42);
+
+    NeighborLists fullLists(matrix, n);
+    ASSERT_EQ(fullLists.getK(), n - 1);
+    NeighborLists lists(matrix, 5);
+    ASSERT_EQ(lists.getK(), 5u);
+    for (size_t c = 0; c < n; c++) {
+        for (size_t r = 0; r < lists.getK(); r++) {
+            EXPECT_NE(lists.get(c)[r], static_cast<int>(c)) << "Una ciudad no es vecina de sí misma";
+        }
+    }
+
+    for (bool returnToStart : {false, true}) {
+        std::vector<int> route = matrix.nearestNeighborRoute(0);
+        std::shuffle(route.begin() + 1, route.end(), rng);
+        double before = matrix.calculateTourCost(route, returnToStart);
+
+        CandidateLocalSearch search(matrix, fullLists, returnToStart, true);
+        double after = search.run(route, CandidateLocalSearch::TWO_OPT | CandidateLocalSearch::OR_OPT);
+
+        EXPECT_LT(after, before);
+        EXPECT_NEAR(after, matrix.calculateTourCost(route, returnToStart), 1e-6);
+        EXPECT_EQ(route[0], 0) << "La posición 0 debe quedar fija";
+        expectValidTour(route, n);
+
+        // Con listas completas no queda ningún 2-opt que mejore
+        TourMoveEvaluator evaluator(matrix, returnToStart);
+        evaluator.update(route);
+        for (size_t i = 1; i < n; i++) {
+            for (size_t j = i + 1; j < n; j++) {
+                EXPECT_GE(evaluator.reverseDelta(route, i, j), -1e-6) << "2-opt " << i << ".." << j;
+            }
+        }
+
+        // Con listas cortas el resultado sigue siendo una ruta válida y mejor
+        std::vector<int> shortRoute = matrix.nearestNeighborRoute(0);
+        std::shuffle(shortRoute.begin() + 1, shortRoute.end(), rng);
+        double shortBefore = matrix.calculateTourCost(shortRoute, returnToStart);
+        CandidateLocalSearch shortSearch(matrix, lists, returnToStart, true);
+        EXPECT_LT(shortSearch.run(shortRoute, CandidateLocalSearch::SWAP | CandidateLocalSearch::OR_OPT), shortBefore);
+    }
+}
+
+TEST(CandidateLocalSearchTest, Or3OptReachesSegmentInsertionOptimumOnOneWayMatrix) {
+    const size_t n = 30;
+    // Calles de un sentido: ir "hacia atrás" cuesta el triple
+    TspMatrix matrix = planarMatrix(n, 17, 3.0);
+    std::mt19937 rng(17);
+
+    NeighborLists fullLists(matrix, n);
+    for (bool returnToStart : {false, true}) {
+        std::vector<int> route = matrix.nearestNeighborRoute(0);
+        std::shuffle(route.begin() + 1, route.end(), rng);
+        double before = matrix.calculateTourCost(route, returnToStart);
+
+        CandidateLocalSearch search(matrix, fullLists, returnToStart, true);
+        EXPECT_FALSE(search.isSymmetric());
+        double after = search.run(route, CandidateLocalSearch::OR_3OPT);
+
+        EXPECT_LT(after, before);
+        EXPECT_NEAR(after, matrix.calculateTourCost(route, returnToStart), 1e-6);
+        EXPECT_EQ(route[0], 0) << "La posición 0 debe quedar fija";
+        expectValidTour(route, n);
+
+        // Con listas completas no queda ningún traslado de segmento (sin inversión) que mejore
+        TourMoveEvaluator evaluator(matrix, returnToStart);
+        for (size_t i = 1; i + 1 < n; i++) {
+            for (size_t last = i; last + 1 < n; last++) {
+                for (size_t j = 0; j < n; j++) {
+                    if (j + 1 >= i && j <= last) continue;
+                    EXPECT_GE(evaluator.orOptDelta(route, i, last, j), -1e-6)
+                        << "segmento " << i << ".." << last << " tras " << j;
+                }
+            }
+        }
+    }
+}
+
+TEST(ILSDBAlgorithmTest, FindsOptimalTourOnSmallAsymmetricInstance) {
+    const size_t n = 8;
+    std::vector<int64_t> ids = sequentialIds(n);
+    TspMatrix matrix = randomMatrix(n, 7);
+
+    double optimum = bruteForceOptimum(matrix, false);
+
+    auto algorithm = TspAlgorithmFactory::create("ilsdb");
+    ASSERT_EQ(algorithm->getName(), "ILSDB");
+    algorithm->setMaxIterations(2000);
+    std::vector<int> tour = algorithm->solve(matrix, ids);
+
+    ASSERT_EQ(tour.size(), n);
+    EXPECT_EQ(tour[0], 0) << "La ruta debe empezar en el índice 0";
+    EXPECT_NEAR(matrix.calculateTourCost(tour, false), optimum, 1e-6);
+}
+
+TEST(LKAlgorithmTest, FindsOptimalToursOnSmallAsymmetricInstance) {
+    const size_t n = 9;
+    std::vector<int64_t> ids = sequentialIds(n);
+    TspMatrix matrix = randomMatrix(n, 11);
+
+    ASSERT_EQ(TspAlgorithmFactory::create("lk")->getName(), "LK");
+
+    for (bool returnToStart : {false, true}) {
+        double optimum = bruteForceOptimum(matrix, returnToStart);
+
+        LKAlgorithm algorithm(500, returnToStart);
+        std::vector<int> tour = algorithm.solve(matrix, ids);
+
+        ASSERT_EQ(tour.size(), n);
+        EXPECT_EQ(tour[0], 0) << "La ruta debe empezar en el índice 0";
+        EXPECT_NEAR(matrix.calculateTourCost(tour, returnToStart), optimum, 1e-6) << "cerrado=" << returnToStart;
+    }
+}
+
+TEST(IGSAAlgorithmTest, ParallelChainsFindOptimalTour) {
+    const size_t n = 9;
+    std::vector<int64_t> ids = sequentialIds(n);
+    TspMatrix matrix = randomMatrix(n, 5);
+
+    double optimum = bruteForceOptimum(matrix, true);
+
+    ASSERT_EQ(TspAlgorithmFactory::create("igsa")->getName(), "IGSA");
+
+    IGSAAlgorithm algorithm(1000, true, 4);
+    std::vector<int> tour = algorithm.solve(matrix, ids);
+
+    ASSERT_EQ(tour.size(), n);
+    EXPECT_EQ(tour[0], 0) << "La ruta debe empezar en el índice 0";
+    expectValidTour(tour, n);
+    EXPECT_NEAR(matrix.calculateTourCost(tour, true), optimum, 1e-6);
+}
+
+TEST(ParallelTspRunnerTest, IslandsMigrateAndReturnBestTour) {
+    const size_t n = 9;
+    std::vector<int64_t> ids = sequentialIds(n);
+    TspMatrix matrix = randomMatrix(n, 9);
+
+    double optimum = bruteForceOptimum(matrix, true);
+
+    std::atomic<int> created{0};
+    ParallelTspRunner runner(
+        [&created]() {
+            created++;
+            return TspAlgorithmFactory::create("ilsdb");
+        },
+        4, 2, 100
+    );
+    EXPECT_EQ(runner.getName(), "Parallel ILSDB");
+    runner.setReturnToStart(true);
+    runner.setMaxIterations(400);
+
+    std::vector<int> tour = runner.solve(matrix, ids);
+
+    EXPECT_EQ(created.load(), 5) << "Una instancia para el nombre y una por isla";
+    ASSERT_EQ(tour.size(), n);
+    expectValidTour(tour, n);
+    EXPECT_NEAR(matrix.calculateTourCost(tour, true), optimum, 1e-6);
+}
+
+TEST(HeldKarpAlgorithmTest, MatchesBruteForceAndThreadedLayers) {
+    const size_t n = 10;
+    std::vector<int64_t> ids = sequentialIds(n);
+    TspMatrix matrix = randomMatrix(n, 23);
+
+    ASSERT_EQ(TspAlgorithmFactory::create("heldkarp")->getName(), "Held-Karp");
+
+    for (bool returnToStart : {false, true}) {
+        double optimum = bruteForceOptimum(matrix, returnToStart);
+
+        HeldKarpAlgorithm algorithm(returnToStart);
+        std::vector<int> tour = algorithm.solve(matrix, ids);
+
+        ASSERT_EQ(tour.size(), n);
+        EXPECT_EQ(tour[0], 0) << "La ruta debe empezar en el índice 0";
+        expectValidTour(tour, n);
+        EXPECT_NEAR(matrix.calculateTourCost(tour, returnToStart), optimum, 1e-6) << "cerrado=" << returnToStart;
+    }
+
+    // Capas repartidas entre hilos: mismo óptimo que en secuencial
+    const size_t large = 16;
+    std::vector<int64_t> largeIds = sequentialIds(large);
+    TspMatrix largeMatrix = randomMatrix(large, 29);
+    HeldKarpAlgorithm sequential(true, 1);
+    HeldKarpAlgorithm threaded(true, 4);
+    double sequentialCost = largeMatrix.calculateTourCost(sequential.solve(largeMatrix, largeIds), true);
+    double threadedCost = largeMatrix.calculateTourCost(threaded.solve(largeMatrix, largeIds), true);
+    EXPECT_DOUBLE_EQ(threadedCost, sequentialCost);
+
+    // Ninguna heurística mejora el óptimo exacto
+    LKAlgorithm lk(200, true);
+    EXPECT_LE(sequentialCost, largeMatrix.calculateTourCost(lk.solve(largeMatrix, largeIds), true) + 1e-6);
+
+    HeldKarpAlgorithm tooLarge;
+    TspMatrix hugeMatrix(HeldKarpAlgorithm::MAX_SIZE + 1, std::vector<int64_t>(HeldKarpAlgorithm::MAX_SIZE + 1, 0));
+    EXPECT_THROW(tooLarge.solve(hugeMatrix, {}), std::invalid_argument);
+}
+
+TEST(TspSolverControlTest, SeedIsReproducibleAndTimeLimitIsHonoured) {
+    const size_t n = 60;
+    std::vector<int64_t> ids = sequentialIds(n);
+    TspMatrix matrix = randomMatrix(n, 31);
+
+    // Misma semilla, misma ruta
+    auto seededRun = [&](std::unique_ptr<ITspAlgorithm> algorithm) {
+        algorithm->setReturnToStart(true);
+        algorithm->setMaxIterations(300);
+        algorithm->setSeed(42);
+        return algorithm->solve(matrix, ids);
+    };
+    for (const char* name : {"ig", "ign", "ilsb", "ilsdb", "lk"}) {
+        EXPECT_EQ(seededRun(TspAlgorithmFactory::create(name)), seededRun(TspAlgorithmFactory::create(name)))
+            << name << " debe ser reproducible con semilla";
+    }
+    EXPECT_EQ(seededRun(std::make_unique<IGSAAlgorithm>(5000, false, 1)),
+              seededRun(std::make_unique<IGSAAlgorithm>(5000, false, 1)));
+    auto makeRunner = []() {
+        return std::make_unique<ParallelTspRunner>(
+            []() { return TspAlgorithmFactory::create("ilsdb"); }, 4, 2, 100);
+    };
+    EXPECT_EQ(seededRun(makeRunner()), seededRun(makeRunner()));
+
+    // El límite de tiempo corta una ejecución de millones de iteraciones
+    auto timedRun = [&](std::unique_ptr<ITspAlgorithm> algorithm) {
+        algorithm->setReturnToStart(true);
+        algorithm->setMaxIterations(100000000);
+        algorithm->setTimeLimit(0.2);
+        auto start = std::chrono::steady_clock::now();
+        std::vector<int> tour = algorithm->solve(matrix, ids);
+        EXPECT_EQ(tour.size(), n);
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    for (const char* name : {"ig", "ign", "ilsb", "ilsdb", "lk", "igsa"}) {
+        EXPECT_LT(timedRun(TspAlgorithmFactory::create(name)), 1.0) << name << " debe respetar el límite de tiempo";
+    }
+    EXPECT_LT(timedRun(makeRunner()), 1.0);
+}
+
+TEST(TspSolverControlTest, ImprovementCallbackStreamsDecreasingIncumbents) {
+    const size_t n = 60;
+    std::vector<int64_t> ids = sequentialIds(n);
+    TspMatrix matrix = randomMatrix(n, 37);
+
+    auto check = [&](std::unique_ptr<ITspAlgorithm> algorithm) {
+        std::vector<double> costs;
+        std::vector<double> times;
+        algorithm->setReturnToStart(true);
+        algorithm->setMaxIterations(500);
+        algorithm->setImprovementCallback([&](const std::vector<int>& tour, double tourCost, double elapsedMs) {
+            EXPECT_NEAR(matrix.calculateTourCost(tour, true), tourCost, 1e-6) << "El costo debe ser el de la ruta";
+            costs.push_back(tourCost);
+            times.push_back(elapsedMs);
+        });
+        std::vector<int> tour = algorithm->solve(matrix, ids);
+
+        ASSERT_FALSE(costs.empty()) << algorithm->getName();
+        for (size_t i = 1; i < costs.size(); i++) {
+            EXPECT_LT(costs[i], costs[i - 1]) << "Cada mejora debe ser estrictamente mejor";
+            EXPECT_GE(times[i], times[i - 1]);
+        }
+        EXPECT_NEAR(costs.back(), matrix.calculateTourCost(tour, true), 1e-6)
+            << algorithm->getName() << ": la última mejora debe ser la ruta final";
+    };
+
+    for (const char* name : {"ig", "ign", "ilsb", "ilsdb", "lk", "igsa"}) {
+        check(TspAlgorithmFactory::create(name));
+    }
+    check(std::make_unique<ParallelTspRunner>([]() { return TspAlgorithmFactory::create("ilsdb"); }, 4, 2, 100));
+}
+
+TEST(PipelinedTspSolverTest, SolvesOnEstimatesWhileRowsLand) {
+    // Cuadrícula 6x5 con calles en ambos sentidos
+    const int cols = 6;
+    const int rows = 5;
+    const double step = 0.001;
+    Graph graph;
+    std::vector<int64_t> ids;
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            graph.addNode(r * cols + c + 1, -16.4 + r * step, -71.5 + c * step);
+            ids.push_back(r * cols + c + 1);
+        }
+    }
+    int64_t edgeId = 1;
+    auto connect = [&](int64_t a, int64_t b) {
+        double meters = graph.getNode(a)->getCoordinate().distanceTo(graph.getNode(b)->getCoordinate());
+        graph.addEdge(edgeId++, a, b, Distance(meters));
+        graph.addEdge(edgeId++, b, a, Distance(meters));
+    };
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int64_t id = r * cols + c + 1;
+            if (c + 1 < cols) connect(id, id + 1);
+            if (r + 1 < rows) connect(id, id + cols);
+        }
+    }
+    graph.buildAdjacencyList();
+
+    const size_t n = ids.size();
+    TspMatrix exact(n, ids);
+    TspMatrix working(n, ids);
+    working.estimateFromCoordinates(graph);
+    DijkstraAlgorithm dijkstra;
+
+    // Filas lentas, para que el solver trabaje mientras llegan
+    std::atomic<int> landed{0};
+    auto precompute = [&](const TspMatrix::RowCallback& onRow) {
+        exact.precompute(graph, &dijkstra, nullptr, nullptr, [&](size_t row) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            landed++;
+            onRow(row);
+        });
+    };
+
+    PipelinedTspSolver pipeline([]() { return TspAlgorithmFactory::create("ilsdb"); }, true, 0.01);
+    pipeline.setSeed(3);
+    std::vector<int> warmTour = pipeline.warmStart(exact, working, ids, precompute);
+
+    EXPECT_EQ(landed.load(), static_cast<int>(n));
+    EXPECT_GE(pipeline.getSlices(), 1u) << "El solver debe avanzar antes de que termine la matriz";
+    ASSERT_EQ(warmTour.size(), n);
+    EXPECT_EQ(warmTour[0], 0) << "La ruta debe empezar en el índice 0";
+    expectValidTour(warmTour, n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            ASSERT_EQ(working.getDistance(i, j), exact.getDistance(i, j)) << "Todas las filas exactas deben copiarse";
+        }
+    }
+
+    // Reoptimización exacta a partir de la ruta precalentada
+    auto algorithm = TspAlgorithmFactory::create("ilsdb");
+    algorithm->setReturnToStart(true);
+    algorithm->setMaxIterations(200);
+    algorithm->setInitialTour(warmTour);
+    std::vector<int> tour = algorithm->solve(exact, ids);
+    EXPECT_LE(exact.calculateTourCost(tour, true), exact.calculateTourCost(warmTour, true) + 1e-6);
+
+    // Los errores del precálculo llegan al llamador
+    auto failing = [](const TspMatrix::RowCallback&) { throw std::runtime_error("precompute"); };
+    EXPECT_THROW(pipeline.warmStart(exact, working, ids, failing), std::runtime_error);
+}
+
+TEST(CheapestInsertionTest, InsertsAtCheapestGapAndIteratedGreedyKeepsStart) {
+    const size_t n = 40;
+    std::vector<int64_t> ids = sequentialIds(n);
+    TspMatrix matrix = randomMatrix(n, 23);
+    std::mt19937 rng(23);
+
+    for (bool returnToStart : {false, true}) {
+        std::vector<int> route = matrix.nearestNeighborRoute(0);
+        std::shuffle(route.begin() + 1, route.end(), rng);
+
+        // Destrucción: el inicio no se toca y nada se pierde
+        std::vector<int> removed;
+        removeRandomCities(route, 6, rng, removed);
+        ASSERT_EQ(removed.size(), 6u);
+        ASSERT_EQ(route.size(), n - 6);
+        EXPECT_EQ(route[0], 0);
+
+        for (int city : removed) {
+            // Mejor hueco por fuerza bruta (nunca antes de la posición 0)
+            double before = matrix.calculateTourCost(route, returnToStart);
+            double bestAdded = std::numeric_limits<double>::infinity();
+            for (size_t pos = 1; pos <= route.size(); pos++) {
+                std::vector<int> trial = route;
+                trial.insert(trial.begin() + pos, city);
+                bestAdded = std::min(bestAdded, matrix.calculateTourCost(trial, returnToStart) - before);
+            }
+
+            double added = cheapestInsertion(route, city, matrix, returnToStart);
+            EXPECT_NEAR(added, bestAdded, 1e-6);
+            EXPECT_NEAR(matrix.calculateTourCost(route, returnToStart), before + added, 1e-6);
+        }
+        expectValidTour(route, n);
+
+        // IG / IGN con reconstrucción voraz: mejoran la ruta inicial
+        double nearest = matrix.calculateTourCost(matrix.nearestNeighborRoute(0), returnToStart);
+        IGAlgorithm ig(300, returnToStart);
+        IGNAlgorithm ign(2000, returnToStart);
+        ig.setDestructionSize(3);
+        ign.setDestructionSize(5);
+        ig.setSeed(5);
+        ign.setSeed(5);
+        std::vector<int> igTour = ig.solve(matrix, ids);
+        ASSERT_EQ(igTour.size(), n);
+        EXPECT_EQ(igTour[0], 0) << "IG debe empezar en el índice 0";
+        EXPECT_LT(matrix.calculateTourCost(igTour, returnToStart), nearest);
+        std::vector<int> ignTour = ign.solve(matrix, ids);
+        ASSERT_EQ(ignTour.size(), n);
+        EXPECT_EQ(ignTour[0], 0) << "IGN debe empezar en el índice 0";
+        EXPECT_LT(matrix.calculateTourCost(ignTour, returnToStart), nearest);
+    }
+}
+
+TEST(TourConstructionTest, EveryConstructionGivesAShortValidTour) {
+    const size_t n = 150;
+    std::vector<int64_t> ids = sequentialIds(n);
+    std::vector<Coordinate> coordinates;
+    TspMatrix matrix = planarMatrix(n, 41, 1.0, &coordinates);
+    std::mt19937 rng(41);
+
+    // Sin coordenadas, la curva de Hilbert usa Nearest Neighbor
+    EXPECT_EQ(constructTour(TourConstruction::SPACE_FILLING_CURVE, matrix, true), matrix.nearestNeighborRoute(0));
+    matrix.setCoordinates(coordinates);
+
+    for (bool returnToStart : {false, true}) {
+        std::vector<int> shuffled = matrix.nearestNeighborRoute(0);
+        std::shuffle(shuffled.begin() + 1, shuffled.end(), rng);
+        double randomCost = matrix.calculateTourCost(shuffled, returnToStart);
+        double nearestCost = matrix.calculateTourCost(matrix.nearestNeighborRoute(0), returnToStart);
+
+        for (TourConstruction construction : {TourConstruction::GREEDY_EDGE, TourConstruction::CHRISTOFIDES,
+                                              TourConstruction::SPACE_FILLING_CURVE}) {
+            std::vector<int> route = constructTour(construction, matrix, returnToStart);
+            ASSERT_EQ(route.size(), n);
+            EXPECT_EQ(route[0], 0) << "La ruta debe empezar en el índice 0";
+            expectValidTour(route, n);
+
+            double cost = matrix.calculateTourCost(route, returnToStart);
+            EXPECT_LT(cost, randomCost * 0.25) << static_cast<int>(construction);
+            if (construction != TourConstruction::SPACE_FILLING_CURVE) {
+                EXPECT_LT(cost, nearestCost * 1.1) << static_cast<int>(construction);
+            }
+        }
+    }
+
+    // Cualquier algoritmo arranca de la construcción elegida
+    for (const char* name : {"greedy", "christofides", "hilbert"}) {
+        auto algorithm = TspAlgorithmFactory::create("ilsdb");
+        algorithm->setConstruction(TspAlgorithmFactory::parseConstruction(name));
+        algorithm->setMaxIterations(0);
+        EXPECT_EQ(algorithm->solve(matrix, ids).size(), n) << name;
+    }
+    EXPECT_THROW(TspAlgorithmFactory::parseConstruction("spiral"), std::invalid_argument);
+
+    // Casos pequeños
+    TspMatrix tiny(2, {1, 2});
+    tiny.setDistance(0, 1, 5.0);
+    tiny.setDistance(1, 0, 7.0);
+    EXPECT_EQ(greedyEdgeRoute(tiny, true), (std::vector<int>{0, 1}));
+    EXPECT_EQ(christofidesRoute(tiny, false), (std::vector<int>{0, 1}));
+}
+
+TEST(OneTreeBoundTest, BoundsTheOptimumAndStopsSolversAtTargetGap) {
+    // Cota <= óptimo por fuerza bruta, ruta cerrada y abierta, simétrica y asimétrica
+    const size_t small = 9;
+    for (bool symmetric : {true, false}) {
+        TspMatrix matrix = planarMatrix(small, 53, symmetric ? 1.0 : 1.5);
+        for (bool returnToStart : {false, true}) {
+            double optimum = bruteForceOptimum(matrix, returnToStart);
+
+            OneTreeBound bound(matrix, returnToStart);
+            double lowerBound = bound.compute(matrix.calculateTourCost(matrix.nearestNeighborRoute(0), returnToStart));
+            EXPECT_LE(lowerBound, optimum + 1e-6) << "La cota no puede superar el óptimo";
+            if (symmetric) {
+                EXPECT_GT(lowerBound, optimum * 0.9) << "La cota debe ser ajustada";
+            }
+            EXPECT_NEAR(OneTreeBound::gap(optimum, lowerBound), (optimum - lowerBound) / lowerBound, 1e-12);
+        }
+    }
+    EXPECT_LT(OneTreeBound::gap(100.0, 0.0), 0.0) << "Sin cota, gap desconocido";
+
+    // Con gap objetivo, los algoritmos paran antes de sus iteraciones
+    const size_t n = 120;
+    std::vector<int64_t> ids = sequentialIds(n);
+    TspMatrix matrix = planarMatrix(n, 59);
+    OneTreeBound bound(matrix, true);
+    double lowerBound = bound.compute(matrix.calculateTourCost(matrix.nearestNeighborRoute(0), true));
+    ASSERT_GT(lowerBound, 0.0);
+
+    auto stopsAtGap = [&](std::unique_ptr<ITspAlgorithm> algorithm) {
+        algorithm->setReturnToStart(true);
+        algorithm->setMaxIterations(100000000);
+        algorithm->setTimeLimit(10.0);
+        algorithm->setTargetGap(lowerBound, 0.03);
+        auto start = std::chrono::steady_clock::now();
+        std::vector<int> tour = algorithm->solve(matrix, ids);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        EXPECT_EQ(tour.size(), n);
+        EXPECT_LE(matrix.calculateTourCost(tour, true), lowerBound * 1.03) << algorithm->getName();
+        EXPECT_LT(seconds, 5.0) << algorithm->getName() << " debe parar al alcanzar el gap";
+    };
+    for (const char* name : {"ilsdb", "lk"}) {
+        stopsAtGap(TspAlgorithmFactory::create(name));
+    }
+    stopsAtGap(std::make_unique<IGSAAlgorithm>(100000000, true, 2));
+    stopsAtGap(std::make_unique<ParallelTspRunner>(
+        []() { return TspAlgorithmFactory::create("ilsdb"); }, 2, 1, 100));
+}